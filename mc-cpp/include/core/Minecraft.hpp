@@ -5,6 +5,7 @@
 #include "core/MouseHandler.hpp"
 #include <memory>
 #include <string>
+#include <vector>
 
 struct GLFWwindow;
 
@@ -32,6 +33,13 @@ public:
     int framebufferHeight;
     bool fullscreen;
 
+    // Offscreen mode (set before init): hidden window, frames drawn into the
+    // device's offscreen target, optionally captured to PNG
+    bool offscreen;
+    int captureInterval;           // Capture every Nth frame, 0 for none
+    std::string captureDirectory;
+    int frameLimit;                // Quit after this many frames, 0 for no limit
+
     // Game state
     bool running;
     bool paused;
@@ -111,6 +119,7 @@ private:
     void initGL();
     void initWorld();
     void updateFps();
+    void printFrameTimes(std::vector<double>& frameTimes) const;
     void processInput();
 };
 
@@ -44,6 +44,8 @@ public:
     // Misc (C++ additions, not in Java b1.2)
     int guiScale = 0;  // 0=auto, 1=small, 2=normal, 3=large
     float fov = 70.0f;
+    bool smoothLighting = false;  // Per-vertex light and ambient occlusion on cubes
+    bool distantTerrain = false;  // Coarse heightmap terrain out to 4x the render distance
 
     // Third person view (toggled with F5 at runtime, not saved)
     bool thirdPersonView = false;
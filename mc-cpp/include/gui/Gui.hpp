@@ -4,6 +4,7 @@
 #include "item/Inventory.hpp"
 #include <GL/glew.h>
 #include <random>
+#include <vector>
 
 namespace mc {
 
@@ -66,6 +67,14 @@ public:
     // Renders at position (x, y) with optional stack count display
     static void renderGuiItem(const ItemStack& item, int x, int y, float z, Font* font, TileRenderer& tileRenderer);
 
+    // Several slots at once: one batch from the item icon atlas when it's
+    // built, then the stack counts. Empty stacks are skipped.
+    struct SlotItem {
+        const ItemStack* item;
+        int x, y;
+    };
+    static void renderGuiItems(const std::vector<SlotItem>& items, float z, Font* font, TileRenderer& tileRenderer);
+
 protected:
     void setupOrtho();
     void restoreProjection();
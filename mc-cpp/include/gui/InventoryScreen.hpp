@@ -1,7 +1,9 @@
 #pragma once
 
 #include "gui/Screen.hpp"
+#include "gui/Gui.hpp"
 #include "item/Inventory.hpp"
+#include <vector>
 
 namespace mc {
 
@@ -43,7 +45,7 @@ private:
     // Rendering helpers
     void renderBackground();
     void renderSlots();
-    void renderSlot(int slotIndex, int x, int y);
+    void addSlot(std::vector<Gui::SlotItem>& items, int slotIndex, int x, int y);
     void renderSlotHighlight(int x, int y);
     void renderDraggedItem();
     void renderTooltip();
@@ -44,6 +44,8 @@ private:
     std::string getVsyncLabel() const;
     std::string getDifficultyLabel() const;
     std::string getGraphicsLabel() const;
+    std::string getSmoothLightingLabel() const;
+    std::string getDistantTerrainLabel() const;
 
     // Button IDs matching Java Option.ordinal() order
     // Progress options (sliders in Java, cycle buttons here for now)
@@ -57,6 +59,9 @@ private:
     static constexpr int BUTTON_VSYNC = 7;
     static constexpr int BUTTON_DIFFICULTY = 8;
     static constexpr int BUTTON_GRAPHICS = 9;
+    // C++ additions
+    static constexpr int BUTTON_SMOOTH_LIGHTING = 10;
+    static constexpr int BUTTON_DISTANT_TERRAIN = 11;
     // Special buttons
     static constexpr int BUTTON_CONTROLS = 100;
     static constexpr int BUTTON_DONE = 200;
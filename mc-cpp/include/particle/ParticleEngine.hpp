@@ -3,20 +3,26 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <random>
+#include <cstdint>
 
 namespace mc {
 
 class Level;
-class Particle;
 class Entity;
+class VertexBuffer;
 
+// Particles are stored as a structure of arrays: ticking walks flat arrays
+// with no per-particle allocation or virtual calls, and a dead particle is
+// replaced by the last one. Rendering packs one instance per particle and
+// draws them all as billboards in a single instanced draw (particle.vert).
 class ParticleEngine {
 public:
-    // Texture type constants
-    static constexpr int MISC_TEXTURE = 0;     // particles.png
-    static constexpr int TERRAIN_TEXTURE = 1;  // terrain.png
-    static constexpr int ITEM_TEXTURE = 2;     // gui/items.png
-    static constexpr int TEXTURE_COUNT = 3;
+    enum class Type : uint8_t {
+        Explode,  // Grey puff that rises and cycles tiles 7..0
+        Smoke,    // Dark puff that grows, rises and spreads along ceilings
+        Flame     // Shrinking flame, no collision
+    };
 
     ParticleEngine();
     ~ParticleEngine();
@@ -24,8 +30,8 @@ public:
     // Set level reference
     void setLevel(Level* level);
 
-    // Add particle
-    void add(std::unique_ptr<Particle> particle);
+    // Spawn a particle; xa/ya/za is the initial velocity it is jittered around
+    void add(Type type, double x, double y, double z, double xa, double ya, double za);
 
     // Add particle by name (convenience method for Level::addParticle)
     void addParticle(const std::string& name, double x, double y, double z,
@@ -44,10 +50,42 @@ public:
     void clear();
 
 private:
+    // Collision box, the same for every type
+    static constexpr double BB_SIZE = 0.2;
+
+    // Move particle i by (dx, dy, dz), stopping at collision boxes
+    void move(size_t i, double dx, double dy, double dz);
+    void updateBrightness(size_t i);
+    float getRenderSize(size_t i, float partialTick) const;
+    void removeAt(size_t i);
+
+    float nextFloat() { return static_cast<float>(random()) / random.max(); }
+
     Level* level;
+    std::mt19937 random;
+
+    // Per particle, all indexed together
+    std::vector<Type> types;
+    std::vector<double> xs, ys, zs;
+    std::vector<double> prevXs, prevYs, prevZs;
+    std::vector<double> xds, yds, zds;
+    std::vector<float> sizes;        // Size before any age scaling
+    std::vector<float> shades;       // Grey level; every type is grey
+    std::vector<float> brightness;   // Light at the particle, sampled each tick
+    std::vector<int> ages;
+    std::vector<int> lifetimes;
+    std::vector<uint8_t> tiles;      // particles.png tile
+    std::vector<uint8_t> onGround;
 
-    // Particles grouped by texture type
-    std::vector<std::unique_ptr<Particle>> particles[TEXTURE_COUNT];
+    // Instance staging and buffers, created on first render
+    struct Instance {
+        float x, y, z, radius;
+        uint32_t color;  // RGBA8
+        float tile;
+    };
+    std::vector<Instance> instances;
+    std::unique_ptr<VertexBuffer> cornerBuffer;
+    std::unique_ptr<VertexBuffer> instanceBuffer;
 };
 
 } // namespace mc
@@ -1,15 +1,77 @@
 #pragma once
 
 #include "phys/AABB.hpp"
-#include "renderer/Tesselator.hpp"
+#include "renderer/ChunkBufferArena.hpp"
 #include <memory>
+#include <vector>
+#include <utility>
+#include <cstdint>
 
 namespace mc {
 
 class Level;
 class TileRenderer;
-class VertexBuffer;
-class IndexBuffer;
+class ChunkSnapshot;
+
+// One render pass of a chunk mesh, vertices packed in ChunkVertexFormat
+// (three uints each, positions relative to the chunk origin). Always a quad
+// list, drawn with the device's shared quad index buffer.
+struct ChunkMeshPass {
+    std::vector<uint32_t> vertices;
+    int vertexCount = 0;
+};
+
+// Which of a chunk's six faces (0 down, 1 up, 2 north, 3 south, 4 west,
+// 5 east, as tile faces) can see each other through non-opaque cells: one bit
+// per unordered pair of faces, 15 in all. Filled at mesh time; a chunk that
+// was never meshed counts as fully open.
+struct ChunkVisibility {
+    static constexpr uint16_t ALL_CONNECTED = 0x7FFF;
+
+    uint16_t mask = ALL_CONNECTED;
+
+    static int pairBit(int faceA, int faceB) {
+        if (faceA > faceB) std::swap(faceA, faceB);
+        return faceA * (11 - faceA) / 2 + (faceB - faceA - 1);
+    }
+
+    bool connects(int faceA, int faceB) const {
+        return faceA == faceB || (mask & (1u << pairBit(faceA, faceB))) != 0;
+    }
+
+    void connect(int faceA, int faceB) {
+        if (faceA != faceB) mask |= static_cast<uint16_t>(1u << pairBit(faceA, faceB));
+    }
+};
+
+// Which quads of a mesh take their flat light from which snapshot cell
+// (ChunkSnapshot::getCellIndex), so a light change can be written into the
+// uploaded vertices instead of remeshing. Not patchable when any quad's light
+// has no single source cell (smooth lighting).
+struct ChunkLightRefs {
+    struct Ref {
+        int cell;
+        uint32_t quad;  // Pass << 30 | quad index within the pass
+    };
+
+    std::vector<Ref> quads;         // Sorted by cell
+    std::vector<int> mergedCells;   // Sorted; cells lighting a greedy merged quad
+    bool patchable = false;
+};
+
+// CPU-side result of meshing a chunk, one vertex/index set per render pass.
+// Built anywhere (worker threads included), uploaded on the render thread.
+struct ChunkMesh {
+    ChunkMeshPass solid;
+    ChunkMeshPass cutout;
+    ChunkMeshPass water;
+    ChunkVisibility visibility;
+    ChunkLightRefs light;
+
+    // Centre of each water pass quad relative to the chunk origin (x, y, z per
+    // quad), for sorting the translucent quads against the camera
+    std::vector<float> waterCentroids;
+};
 
 class Chunk {
 public:
@@ -28,6 +90,9 @@ public:
     // Bounding box for culling
     AABB bb;
 
+    // Face-to-face connectivity from the last uploaded mesh (cave culling)
+    ChunkVisibility visibility;
+
     // Stats
     int solidVertexCount;
     int cutoutVertexCount;
@@ -39,19 +104,71 @@ public:
     // Distance for sorting
     float distanceSq;
 
+    // Mesh generations: bumped each time a build is scheduled, and recorded
+    // when a build is uploaded, so an older build finishing late is dropped
+    uint32_t buildGeneration;
+    uint32_t uploadedGeneration;
+
+    // Water pass quad order: camera position the quads were last sorted
+    // back-to-front for, and whether a sort is queued or has been applied
+    // to the current mesh
+    double waterSortX, waterSortY, waterSortZ;
+    bool waterSortPending;
+    bool waterSorted;
+
+    // Re-sort once the camera has moved this far (blocks) since the last sort
+    static constexpr double WATER_SORT_DISTANCE = 1.0;
+
     Level* level;
 
-    Chunk(Level* level, int x0, int y0, int z0);
+    // Vertex storage shared with every other chunk (must outlive the chunk)
+    ChunkBufferArena* arena;
+
+    Chunk(Level* level, ChunkBufferArena* arena, int x0, int y0, int z0);
     ~Chunk();
 
-    // Rebuild the chunk mesh
+    // Rebuild the chunk mesh synchronously (snapshot, build and upload)
     void rebuild(TileRenderer& renderer);
-    void rebuildSolid(TileRenderer& renderer);
-    void rebuildCutout(TileRenderer& renderer);
-    void rebuildWater(TileRenderer& renderer);
 
-    // Render the chunk
-    void render(int pass);
+    // Copy the blocks and light this chunk's mesh depends on (main thread)
+    void captureSnapshot(ChunkSnapshot& snapshot) const;
+
+    // Build all passes from a snapshot in a single scan of the chunk. Touches no
+    // GPU or level state, so it is safe on a worker thread as long as the
+    // renderer has its own tesselator.
+    void buildMesh(TileRenderer& renderer, const ChunkSnapshot& snapshot, ChunkMesh& mesh) const;
+
+    // Upload a built mesh into the arena (render thread only). Keeps the
+    // vertices when the mesh's light can be patched.
+    void uploadMesh(ChunkMesh&& mesh);
+
+    // The light of cell (x, y, z) changed. Queues a patch if the uploaded mesh
+    // allows one, otherwise marks the chunk dirty. Returns true when the chunk
+    // starts needing applyLightPatches().
+    bool lightChanged(int x, int y, int z);
+
+    // Rewrite the light of the vertices reading the queued cells and upload
+    // only those vertices (render thread only)
+    void applyLightPatches();
+
+    // True if the water quads should be re-sorted for this camera position
+    bool needsWaterSort(double camX, double camY, double camZ) const;
+    const std::vector<float>& getWaterCentroids() const { return waterCentroids; }
+
+    // Order quads farthest first from (camX, camY, camZ), given relative to the
+    // same origin as the centroids. Radix sort; touches no chunk state, so it
+    // runs on mesh workers.
+    static void sortQuadsBackToFront(const std::vector<float>& centroids,
+                                     float camX, float camY, float camZ,
+                                     std::vector<uint32_t>& order);
+
+    // Rewrite the water range in the given quad order (indices into the
+    // mesh's water quads) with one upload (render thread only)
+    void applyWaterOrder(const std::vector<uint32_t>& order);
+
+    // Arena range holding a pass's vertices (empty if the pass has none).
+    // LevelRenderer draws the ranges of all visible chunks in one call.
+    const ChunkBufferArena::Allocation& getPassRange(int pass) const;
 
     // Mark as needing rebuild
     void setDirty();
@@ -66,22 +183,38 @@ public:
     void dispose();
 
 private:
-    void uploadData(VertexBuffer* vbo, IndexBuffer* ebo,
-                    const Tesselator::VertexData& data);
-
-    // RenderDevice buffers for solid geometry
-    std::unique_ptr<VertexBuffer> solidVBO;
-    std::unique_ptr<IndexBuffer> solidEBO;
-
-    // RenderDevice buffers for cutout geometry (torches, flowers, etc.)
-    std::unique_ptr<VertexBuffer> cutoutVBO;
-    std::unique_ptr<IndexBuffer> cutoutEBO;
-
-    // RenderDevice buffers for water geometry
-    std::unique_ptr<VertexBuffer> waterVBO;
-    std::unique_ptr<IndexBuffer> waterEBO;
-
-    bool vaoInitialized;
+    // Which render pass a tile's geometry goes to
+    enum class Pass { Solid, Cutout, Water };
+
+    // Flood fill the non-opaque cells to find which faces connect
+    void computeVisibility(const ChunkSnapshot& snapshot, ChunkVisibility& out) const;
+
+    // Append count Tesselator vertices starting at src to out, packed
+    void packVertices(const int* src, int count, ChunkMeshPass& out) const;
+
+    // Replace a pass's arena range with the new vertices
+    void uploadData(ChunkBufferArena::Allocation& range, const ChunkMeshPass& data);
+
+    // Arena ranges per pass (indices come from the device's shared quad
+    // index buffer)
+    ChunkBufferArena::Allocation solidRange;
+    ChunkBufferArena::Allocation cutoutRange;   // Torches, flowers, etc.
+    ChunkBufferArena::Allocation waterRange;
+
+    // Light patching: the uploaded mesh's refs, its packed vertices per pass
+    // (only kept while patchable) and the cells waiting to be patched
+    struct PendingLight {
+        int x, y, z;
+    };
+    ChunkLightRefs lightRefs;
+    std::vector<uint32_t> passVertices[3];
+    std::vector<PendingLight> pendingLight;
+
+    // Water quad centroids in mesh order, and where each of those quads now
+    // sits in the water range (empty until the first sort). The water pass
+    // vertices are always kept, in uploaded order, for re-sorting.
+    std::vector<float> waterCentroids;
+    std::vector<uint32_t> waterSlots;
 };
 
 } // namespace mc
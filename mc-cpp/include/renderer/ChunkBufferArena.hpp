@@ -0,0 +1,59 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <cstdint>
+
+namespace mc {
+
+class VertexBuffer;
+
+// One device vertex buffer shared by every chunk mesh, carved into ranges
+// with a first-fit free list. Chunks own vertex ranges rather than buffers,
+// so a whole pass of visible chunks draws from one bound buffer with a single
+// multi-draw. Vertices are ChunkVertexFormat; render thread only.
+class ChunkBufferArena {
+public:
+    struct Allocation {
+        uint32_t first = 0;  // First vertex in the arena buffer
+        uint32_t count = 0;  // Vertex count, 0 when nothing is allocated
+
+        bool empty() const { return count == 0; }
+    };
+
+    explicit ChunkBufferArena(uint32_t initialCapacity = 1u << 20);
+    ~ChunkBufferArena();
+
+    // Allocate vertexCount vertices and upload them. Grows the buffer (copying
+    // the live ranges over) when no free range is large enough. Returns an
+    // empty allocation for an empty mesh.
+    Allocation allocate(const void* vertices, uint32_t vertexCount);
+
+    // Overwrite vertexCount vertices of an allocation in place, starting at
+    // its firstVertex-th vertex (light patches)
+    void update(const Allocation& allocation, uint32_t firstVertex,
+                const void* vertices, uint32_t vertexCount);
+
+    // Return a range to the free list, merging it with its neighbours, and reset it
+    void free(Allocation& allocation);
+
+    // Null until the first allocation
+    VertexBuffer* getBuffer() const { return buffer.get(); }
+
+    uint32_t getCapacity() const { return capacity; }   // In vertices
+    uint32_t getUsedVertices() const { return used; }
+
+private:
+    void grow(uint32_t minCapacity);
+    void addFreeRange(uint32_t first, uint32_t count);
+
+    std::unique_ptr<VertexBuffer> buffer;
+    uint32_t initialCapacity;
+    uint32_t capacity;
+    uint32_t used;
+
+    // Free ranges: first vertex -> vertex count, never adjacent to each other
+    std::map<uint32_t, uint32_t> freeRanges;
+};
+
+} // namespace mc
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "renderer/Chunk.hpp"
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <functional>
+#include <cstdint>
+
+namespace mc {
+
+class Tesselator;
+class TileRenderer;
+class ChunkSnapshot;
+
+// Builds chunk meshes on worker threads. The main thread snapshots a dirty
+// chunk and queues it; a worker meshes the snapshot with its own CPU-only
+// Tesselator and TileRenderer; the finished mesh comes back to the main
+// thread, which only does the GPU upload. Workers also sort chunks' water
+// quads back-to-front as the camera moves, and run other background meshing
+// tasks (distant terrain) after the chunk builds.
+class ChunkMeshBuilder {
+public:
+    // threadCount <= 0 picks hardware_concurrency - 1 (at least 1)
+    explicit ChunkMeshBuilder(int threadCount = 0);
+    ~ChunkMeshBuilder();
+
+    // Snapshot the chunk and queue a build. Clears the chunk's dirty flag; if
+    // it changes again before the build lands it is simply scheduled again.
+    void schedule(Chunk* chunk, bool smoothLighting);
+
+    // Upload up to maxUploads finished meshes, returns how many were uploaded
+    int uploadFinished(int maxUploads);
+
+    // Queue a back-to-front sort of the chunk's water quads for a camera
+    // position (world space). Sorts go ahead of mesh builds.
+    void scheduleSort(Chunk* chunk, double camX, double camY, double camZ);
+
+    // Reorder the water ranges of chunks whose sorts finished, returns how
+    // many were applied
+    int applyFinishedSorts();
+
+    // Run work on a worker with that worker's tile renderer (CPU-only
+    // tesselator, no level or snapshot set), then finish on the render thread
+    // in finishTasks(). Tasks queue behind chunk builds.
+    void scheduleTask(std::function<void(TileRenderer&)> work, std::function<void()> finish);
+
+    // Run the finish step of every task whose work is done, returns how many
+    int finishTasks();
+
+    // Drop queued jobs and unuploaded results, waiting for in-flight builds.
+    // Must be called before any chunk with outstanding work is destroyed.
+    void discardAll();
+
+    // Block until every queued build, sort and task has run. Results stay
+    // queued for the render thread. For benchmarks wanting repeatable frames.
+    void waitIdle();
+
+    // Jobs queued or being built (not counting finished, unuploaded meshes)
+    size_t getPendingCount() const;
+
+    int getThreadCount() const { return static_cast<int>(workers.size()); }
+
+private:
+    struct Job {
+        Chunk* chunk;
+        uint32_t generation;
+        bool smoothLighting;
+        std::unique_ptr<ChunkSnapshot> snapshot;
+    };
+
+    struct Result {
+        Chunk* chunk;
+        uint32_t generation;
+        ChunkMesh mesh;
+    };
+
+    // Sorts are tied to the uploaded mesh they were taken from
+    struct SortJob {
+        Chunk* chunk;
+        uint32_t generation;
+        float camX, camY, camZ;  // Relative to the chunk origin
+        std::vector<float> centroids;
+    };
+
+    struct SortResult {
+        Chunk* chunk;
+        uint32_t generation;
+        std::vector<uint32_t> order;
+    };
+
+    struct Task {
+        std::function<void(TileRenderer&)> work;
+        std::function<void()> finish;
+    };
+
+    // Each worker owns its tesselator and tile renderer, so no meshing state is shared
+    struct Worker {
+        std::unique_ptr<Tesselator> tesselator;
+        std::unique_ptr<TileRenderer> renderer;
+        std::thread thread;
+    };
+
+    void workerFunction(Worker* worker);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<bool> running;
+
+    // Job queue (nearest chunks are scheduled first, so FIFO keeps that order)
+    std::deque<Job> jobs;
+    std::deque<SortJob> sortJobs;
+    std::deque<Task> tasks;
+    int busyWorkers;
+    mutable std::mutex jobMutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobsDrained;
+
+    // Finished meshes waiting for upload
+    std::vector<Result> results;
+    std::vector<SortResult> sortResults;
+    std::vector<std::function<void()>> finishedTasks;
+    std::mutex resultMutex;
+};
+
+} // namespace mc
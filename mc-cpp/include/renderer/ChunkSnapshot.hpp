@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+namespace mc {
+
+class Level;
+class Tile;
+
+// Copy of the blocks, metadata and light around one chunk, taken on the main
+// thread so a mesh can be built on a worker while the level keeps changing.
+// Covers the chunk plus a one block border (face culling and corner light
+// look one block out). Reads outside the captured box fall back to what
+// Level returns outside the world: air, full sky light, no block light.
+class ChunkSnapshot {
+public:
+    static constexpr int BORDER = 1;
+
+    ChunkSnapshot();
+
+    // Capture the size^3 chunk at (x0, y0, z0) plus the border
+    void capture(const Level& level, int x0, int y0, int z0, int size);
+
+    // Record an all-air chunk without copying anything (nothing will be read)
+    void captureEmpty();
+
+    int getTile(int x, int y, int z) const;
+    Tile* getTileAt(int x, int y, int z) const;
+    int getData(int x, int y, int z) const;
+    int getSkyLight(int x, int y, int z) const;
+    int getBlockLight(int x, int y, int z) const;
+
+    // Index of a cell within the captured box, -1 outside it. The static form
+    // gives the same index for the box capture() takes around the size^3 chunk
+    // at (x0, y0, z0), so it still works once the snapshot is gone.
+    int getCellIndex(int x, int y, int z) const;
+    static int getCellIndex(int x, int y, int z, int x0, int y0, int z0, int size);
+
+    // True if the chunk part of the snapshot holds nothing but air
+    bool isEmpty() const { return empty; }
+
+private:
+    bool contains(int x, int y, int z) const;
+    int getIndex(int x, int y, int z) const;
+
+    // Origin (including the border) and edge length of the captured box
+    int ox, oy, oz;
+    int dim;
+
+    std::vector<uint8_t> blocks;
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> skyLight;
+    std::vector<uint8_t> blockLight;
+    bool empty;
+};
+
+} // namespace mc
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "renderer/ShaderManager.hpp"
+#include "renderer/Textures.hpp"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace mc {
+
+// Draws recorded in any order and submitted sorted by state: pass, then
+// shader, then texture, then depth. Each shader and texture is selected once
+// per run of draws sharing it instead of once per draw.
+class DrawQueue {
+public:
+    using DrawFn = std::function<void()>;
+    using PassFn = std::function<void(int pass)>;
+
+    // pass: 0-255, drawn in increasing order. depth: sort distance within a
+    // shader and texture, nearest first (negate it for back to front).
+    // draw issues the geometry with the shader and texture already bound,
+    // and must leave them bound.
+    void add(int pass, ShaderManager::Program shader, TextureHandle texture, float depth, DrawFn draw);
+
+    bool empty() const { return draws.empty(); }
+
+    // Issue and clear the queued draws. beginPass, if given, runs before the
+    // first draw of each pass to set pass-wide device state.
+    void submit(const PassFn& beginPass = nullptr);
+
+private:
+    struct Entry {
+        uint64_t key;     // pass 8 | shader 8 | texture 16 | depth 32
+        uint32_t index;   // Into draws
+    };
+
+    static uint32_t depthBits(float depth);
+
+    std::vector<Entry> entries;
+    std::vector<DrawFn> draws;
+    std::vector<TextureHandle> textures;  // Key texture field -> texture, for this batch
+};
+
+} // namespace mc
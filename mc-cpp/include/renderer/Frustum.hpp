@@ -6,6 +6,8 @@ namespace mc {
 
 class Frustum {
 public:
+    enum class Containment { Outside, Intersects, Inside };
+
     static Frustum& getInstance();
 
     void update();
@@ -14,6 +16,10 @@ public:
     bool isVisible(double x0, double y0, double z0, double x1, double y1, double z1) const;
     bool containsPoint(double x, double y, double z) const;
 
+    // Like isVisible, but also tells boxes wholly inside apart from ones
+    // crossing a plane, so everything within an Inside box can skip its tests
+    Containment classify(const AABB& box) const;
+
 private:
     Frustum() = default;
 
@@ -13,7 +13,8 @@ public:
     static std::string transpile450to330(const std::string& source);
 
     // Extract uniforms from uniform blocks to individual uniforms
-    // (useful for C++ API compatibility even on OGL 4.5+)
+    // (useful for C++ API compatibility even on OGL 4.5+). Blocks declared
+    // std140 are left alone: they are backed by a uniform buffer.
     static std::string extractUniformBlocks(const std::string& source);
 
 private:
@@ -26,6 +27,9 @@ private:
     // Remove layout(binding = N) from samplers
     static std::string removeSamplerBindings(const std::string& source);
 
+    // Remove binding = N from std140 uniform block layouts
+    static std::string removeBlockBindings(const std::string& source);
+
     // Change version from 450 to 330
     static std::string changeVersion(const std::string& source);
 };
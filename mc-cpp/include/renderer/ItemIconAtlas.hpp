@@ -0,0 +1,54 @@
+#pragma once
+
+#include "renderer/Textures.hpp"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace mc {
+
+class Tesselator;
+class TileRenderer;
+
+// Every block and item icon rendered once into one texture, so GUI slots draw
+// as plain textured quads in a single batch instead of re-rendering 3D blocks
+// every frame. Needs render-to-texture; without it the atlas stays empty and
+// callers draw icons directly with renderIcon().
+class ItemIconAtlas {
+public:
+    static constexpr int ICON_SIZE = 64;  // Pixels per icon (4x the 16-unit GUI slot)
+    static constexpr int COLUMNS = 16;
+
+    static ItemIconAtlas& getInstance();
+
+    // (Re)render every icon; call again after the terrain or item textures change
+    void build();
+    void destroy();
+
+    bool isReady() const { return texture != nullptr; }
+    TextureHandle getTexture() const { return texture.get(); }
+
+    // Add a 16x16 quad at (x, y) showing the icon for id/data. Returns false if
+    // it has no icon (the atlas isn't ready, or nothing draws for the id).
+    bool addIcon(Tesselator& t, int id, int data, float x, float y, float z) const;
+
+    // Draw the icon for id/data into the 16x16 GUI area at (x, y) right now,
+    // switching shader and texture as needed
+    static void renderIcon(int id, int data, float x, float y, float z, TileRenderer& tileRenderer);
+
+private:
+    ItemIconAtlas() = default;
+    ItemIconAtlas(const ItemIconAtlas&) = delete;
+    ItemIconAtlas& operator=(const ItemIconAtlas&) = delete;
+
+    static int slotKey(int id, int data) { return id * 16 + (data & 15); }
+    int getSlot(int id, int data) const;
+    void collectSlots();
+
+    std::unique_ptr<Texture> texture;
+    int rows = 0;
+    std::unordered_map<int, int> slots;  // slotKey -> atlas slot
+    std::vector<int> slotKeys;           // Atlas slot -> slotKey it was rendered for
+};
+
+} // namespace mc
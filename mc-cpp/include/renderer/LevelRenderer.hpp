@@ -3,8 +3,13 @@
 #include "world/Level.hpp"
 #include "renderer/Chunk.hpp"
 #include "renderer/TileRenderer.hpp"
+#include "renderer/ChunkMeshBuilder.hpp"
+#include "renderer/TerrainLod.hpp"
 #include "renderer/Frustum.hpp"
+#include "renderer/DrawQueue.hpp"
+#include "renderer/backend/RenderTypes.hpp"
 #include "particle/ParticleEngine.hpp"
+#include "renderer/model/ChickenModel.hpp"
 #include <vector>
 #include <memory>
 #include <array>
@@ -15,12 +20,18 @@ namespace mc {
 class Minecraft;
 class Entity;
 class Tile;
+class Tesselator;
+class VertexBuffer;
 
 class LevelRenderer : public LevelListener {
 public:
     Level* level;
     Minecraft* minecraft;
 
+    // Vertex storage for every chunk mesh; declared before the chunks so it
+    // outlives them
+    std::unique_ptr<ChunkBufferArena> chunkArena;
+
     // Chunks
     std::vector<std::unique_ptr<Chunk>> chunks;
     int xChunks, yChunks, zChunks;
@@ -28,10 +39,17 @@ public:
     // Render lists
     std::vector<Chunk*> visibleChunks;
     std::vector<Chunk*> dirtyChunks;
+    std::vector<Chunk*> lightPatchChunks;  // Chunks with queued light patches
 
     // Tile renderer
     TileRenderer tileRenderer;
 
+    // Builds dirty chunk meshes on worker threads; the main thread only uploads
+    std::unique_ptr<ChunkMeshBuilder> meshBuilder;
+
+    // Heightmap terrain past the render distance (Options::distantTerrain)
+    std::unique_ptr<TerrainLod> terrainLod;
+
     // Particle engine
     ParticleEngine particleEngine;
 
@@ -63,11 +81,16 @@ public:
     void renderAdvancedClouds(float partialTick); // 3D clouds for Fancy graphics
     void renderEntities(float partialTick);
 
+    // Distant terrain beyond the chunks, when enabled. Expects the world
+    // shader and the terrain texture to be bound.
+    void renderDistantTerrain();
+
     // Update chunks
     void updateDirtyChunks();
     void rebuildAllChunks();
 
-    // Culling
+    // Culling: frustum and distance, plus cave culling through the chunks'
+    // face connectivity when the camera is inside the world
     void updateVisibleChunks(double camX, double camY, double camZ);
 
     // LevelListener implementation
@@ -91,12 +114,37 @@ public:
 private:
     void createChunks();
     void disposeChunks();
-    void sortChunks();
+
+    // Call fn for every chunk whose mesh reads block (x, y, z)
+    template <typename Fn>
+    void forChunksReading(int x, int y, int z, Fn&& fn);
+
+    // Rebuild chunksByDistance around the camera's chunk (horizontal: ignore
+    // height, as when distant terrain fills in past the render distance)
+    void rebuildChunkOrder(int camChunkX, int camChunkY, int camChunkZ, bool horizontal);
+    bool isChunkInFrustum(const Chunk* chunk, const Frustum& frustum);
+
+    // Index of a chunk in chunks, also its entry in chunkOrigins
+    uint32_t getChunkIndex(const Chunk* chunk) const;
+    void uploadChunkOrigins();
+
+    // Static sky geometry in the Tesselator vertex format, drawn with the
+    // shared quad indices. Color, scroll and time of day come from uniforms
+    // and the modelview, so each mesh is built once.
+    struct SkyMesh {
+        std::unique_ptr<VertexBuffer> buffer;
+        int quads = 0;
+    };
 
     // Sky rendering initialization
-    void initSkyVAOs();
-    void disposeSkyVAOs();
-    void buildStarData();
+    void initSkyBuffers();
+    void disposeSkyBuffers();
+    void buildSkyPlanes();
+    void buildStars();
+    void buildFastClouds();
+    void buildFancyClouds();
+    void uploadSkyMesh(SkyMesh& mesh, Tesselator& t);
+    void drawSkyMesh(const SkyMesh& mesh, int firstQuad, int quadCount);
     float getTimeOfDay() const;
     std::array<float, 4> getSunriseColor(float timeOfDay) const;
     float getStarBrightness(float timeOfDay) const;
@@ -109,17 +157,48 @@ private:
     void renderTileShadow(Tile* tile, double entityX, double entityY, double entityZ,
                           int tileX, int tileY, int tileZ, float power, float radius);
 
-    // Star vertex data for rendering via Tesselator
-    std::vector<float> starVertices;
-
-    // Legacy VAO handles (kept for initialization, not used)
-    uint32_t starVAO, starVBO, starEBO;
-    uint32_t skyVAO, skyVBO, skyEBO;
-    uint32_t darkVAO, darkVBO, darkEBO;
-    int starIndexCount;
-    int skyIndexCount;
-    int darkIndexCount;
-    bool skyVAOsInitialized;
+    // Per-chunk draw data (origin, ChunkVertexFormat::DRAW_DATA_STRIDE each),
+    // indexed by a draw's base instance. Uploaded once per chunk layout.
+    std::unique_ptr<VertexBuffer> chunkOrigins;
+
+    // One multi-draw command per visible chunk, rebuilt each pass
+    std::vector<DrawIndexedCommand> chunkDrawCommands;
+
+    // Shadow, item and mob draws, queued and submitted in state order each frame
+    DrawQueue entityQueue;
+
+    // Owns the chicken batch's GPU buffers, so they go with the renderer
+    // rather than outliving the device at static destruction
+    ChickenModel chickenModel;
+
+    // Cave culling walk state, kept to reuse the allocations
+    struct VisibilityStep {
+        Chunk* chunk;
+        int entryFace;       // Face we entered by, -1 for the camera's chunk
+        uint8_t directions;  // Bit per face direction taken to get here
+    };
+    std::vector<VisibilityStep> visibilityQueue;
+
+    // Chunks that can be within render distance, nearest first, and a flag
+    // per chunk index for membership. Only rebuilt when the camera changes chunk.
+    std::vector<Chunk*> chunksByDistance;
+    std::vector<uint8_t> chunkInRange;
+    bool chunkOrderValid = false;
+    int orderChunkX = 0, orderChunkY = 0, orderChunkZ = 0;
+    int orderRenderDistance = 0;
+    bool orderHorizontal = false;
+
+    // Per-frame stamps (visibilityFrame) so nothing is cleared each frame:
+    // chunks reached by the walk, and columns whose frustum test is cached
+    uint32_t visibilityFrame = 0;
+    std::vector<uint32_t> chunkVisitFrame;
+    std::vector<uint32_t> columnFrame;
+    std::vector<Frustum::Containment> columnContainment;
+
+    SkyMesh skyPlanes;    // White sky plane quads, then the void plane's
+    SkyMesh stars;
+    SkyMesh fastClouds;   // Built on first use
+    SkyMesh fancyClouds;  // Built on first use
 };
 
 } // namespace mc
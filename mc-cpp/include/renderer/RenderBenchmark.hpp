@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+namespace mc {
+
+class LevelRenderer;
+
+// Headless render-path benchmark (run with --render-bench). Swaps in the null
+// RenderDevice, loads a generated level through the chunk mesh workers, then
+// circles the level on a fixed camera path with a block edit every few frames.
+// Reports time per frame for culling, uploads and draw submission, and the
+// device's upload, draw and state counters. The workers are drained every
+// frame, so the counters repeat from run to run for the same config.
+class RenderBenchmark {
+public:
+    struct Config {
+        int width = 128;
+        int height = 128;
+        int depth = 128;
+        int frames = 600;
+        int editInterval = 10;  // Frames between block edits, 0 for none
+        uint32_t seed = 12345;
+    };
+
+    // Returns false if nothing was drawn
+    static bool run(const Config& config);
+
+private:
+    // Camera on the path at a frame: position, yaw and pitch in degrees
+    struct Camera {
+        double x, y, z;
+        float yaw, pitch;
+    };
+
+    static Camera getCamera(const Config& config, int frame);
+    static void setupMatrices(const Camera& camera);
+
+    // One frame of the render path: culling, worker results, draw submission.
+    // Returns the time spent in each (ms).
+    static void renderFrame(LevelRenderer& levelRenderer, const Camera& camera,
+                            double& cullMs, double& uploadMs, double& drawMs);
+};
+
+} // namespace mc
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "renderer/MatrixStack.hpp"
+#include "renderer/backend/RenderTypes.hpp"
 #include "renderer/backend/ShaderPipeline.hpp"
+#include <cstdint>
 #include <memory>
 
 namespace mc {
@@ -14,15 +16,23 @@ public:
     void destroy();
 
     ShaderPipeline* getWorldShader() { return worldShader.get(); }
+    ShaderPipeline* getChunkShader() { return chunkShader.get(); }
     ShaderPipeline* getSkyShader() { return skyShader.get(); }
     ShaderPipeline* getGuiShader() { return guiShader.get(); }
     ShaderPipeline* getLineShader() { return lineShader.get(); }
 
     void useWorldShader();
+    void useChunkShader();  // Packed chunk vertices, world.frag shading
+    void useParticleShader();  // Instanced billboards, world.frag shading
+    void useModelShader();  // Instanced entity model parts, world.frag shading
     void useSkyShader();
     void useGuiShader();
     void useLineShader();
 
+    // The shaders above by id, for callers that pick one at run time (DrawQueue)
+    enum class Program : uint8_t { World, Chunk, Particle, Model, Sky, Gui, Line };
+    void use(Program program);
+
     void updateMatrices();
     void updateMatrices(const glm::mat4& projection, const glm::mat4& modelview);
     void updateFog(float start, float end, float r, float g, float b);
@@ -32,6 +42,12 @@ public:
     void setUseTexture(bool use);
     void setGuiColor(float r, float g, float b, float a);
     void setUseVertexColor(bool use);  // When true, use vertex colors instead of uniform
+    // World shader: scale vertex colors and offset UVs; reset by useWorldShader()
+    void setColorScale(float r, float g, float b, float a);
+    void setTexOffset(float u, float v);
+    // Particle shader: camera-facing axes the billboards are expanded along
+    void setBillboardAxes(float rightX, float rightY, float rightZ,
+                          float upX, float upY, float upZ);
 
     // Lighting for hand/item rendering (matching Java Lighting.turnOn)
     void enableLighting(bool enable);
@@ -50,17 +66,53 @@ private:
     ShaderManager(const ShaderManager&) = delete;
     ShaderManager& operator=(const ShaderManager&) = delete;
 
+    // Uniform handles of one shader, resolved once at init. Uniforms the
+    // shader lacks resolve to -1, and setting them does nothing.
+    struct Uniforms {
+        UniformHandle mvp, modelView, normalMatrix;
+        UniformHandle colorScale, texOffset;
+        UniformHandle billboardRight, billboardUp;
+        UniformHandle texture, useTexture, alphaTest;
+        UniformHandle color, useUniformColor;
+        UniformHandle enableLighting, lightDir0, lightDir1;
+        UniformHandle ambient, diffuse, brightness;
+
+        void resolve(ShaderPipeline& shader);
+    };
+
+    // Bind a shader and make it current, with the current matrices
+    void use(ShaderPipeline& shader, Uniforms& shaderUniforms);
+    // Upload the frame constants if they differ from the last upload
+    void setFrameUniforms(const FrameUniforms& uniforms);
+
+    // Shaders that share world.frag and its fragment uniforms
+    bool hasWorldFragment() const {
+        return currentShader && (currentShader == worldShader.get() || currentShader == chunkShader.get() ||
+                                 currentShader == particleShader.get() || currentShader == modelShader.get());
+    }
+
     std::unique_ptr<ShaderPipeline> worldShader;
+    std::unique_ptr<ShaderPipeline> chunkShader;
+    std::unique_ptr<ShaderPipeline> particleShader;
+    std::unique_ptr<ShaderPipeline> modelShader;
     std::unique_ptr<ShaderPipeline> skyShader;
     std::unique_ptr<ShaderPipeline> guiShader;
     std::unique_ptr<ShaderPipeline> lineShader;
 
+    Uniforms worldUniforms;
+    Uniforms chunkUniforms;
+    Uniforms particleUniforms;
+    Uniforms modelUniforms;
+    Uniforms skyUniforms;
+    Uniforms guiUniforms;
+    Uniforms lineUniforms;
+
     ShaderPipeline* currentShader = nullptr;
+    Uniforms* current = nullptr;  // currentShader's handles
     bool initialized = false;
 
-    float fogStart = 0.0f;
-    float fogEnd = 100.0f;
-    float fogR = 0.5f, fogG = 0.8f, fogB = 1.0f;
+    // Fog and sky brightness, shared by every world.frag shader
+    FrameUniforms frame{{0.5f, 0.8f, 1.0f}, 0.0f, 100.0f, 1.0f, {}};
     float alphaThreshold = 0.0f;
 };
 
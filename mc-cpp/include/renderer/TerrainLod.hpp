@@ -0,0 +1,96 @@
+#pragma once
+
+#include "renderer/backend/RenderTypes.hpp"
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace mc {
+
+class Level;
+class Frustum;
+class TileRenderer;
+class VertexBuffer;
+class ChunkMeshBuilder;
+
+// Coarse far-field terrain past the chunk render distance. The world is split
+// into regions of REGION_CHUNKS x REGION_CHUNKS chunk columns, each meshed
+// from the level's height map on the mesh workers: every CELL_SIZE x CELL_SIZE
+// block cell becomes one top face at its highest column, textured with that
+// column's surface tile, with walls down to lower neighbours. Walls on chunk
+// column edges hang SKIRT_DEPTH blocks further to hide cracks against detail
+// chunks. Vertices are grouped by chunk column, so columns the detail chunks
+// cover are simply not drawn. Tesselator vertex format, world shader.
+class TerrainLod {
+public:
+    static constexpr int REGION_CHUNKS = 4;
+    static constexpr int CELL_SIZE = 4;
+    static constexpr int SKIRT_DEPTH = 8;
+
+    // Far terrain reaches this many times the detail render distance
+    static constexpr int DISTANCE_SCALE = 4;
+
+    explicit TerrainLod(Level* level);
+    ~TerrainLod();
+
+    // A block changed: rebuild the regions sampling it when next in range
+    void tileChanged(int x, int z);
+    void allChanged();
+
+    // Queue builds for stale regions in range, nearest first
+    // (detailDistance in chunks)
+    void update(ChunkMeshBuilder& builder, double camX, double camZ, int detailDistance);
+
+    // Draw the chunk columns between the detail and far distances. Expects
+    // the world shader and the terrain texture to be bound.
+    void render(const Frustum& frustum);
+
+private:
+    static constexpr int COLUMN_CELLS = 16 / CELL_SIZE;  // Cells along a chunk column
+    static constexpr int REGION_CELLS = REGION_CHUNKS * COLUMN_CELLS;
+    static constexpr int SAMPLE_DIM = REGION_CELLS + 2;  // Plus a border cell for walls
+    static constexpr int REGION_COLUMNS = REGION_CHUNKS * REGION_CHUNKS;
+
+    // Highest column of a cell (height map value) and the tile on top of it;
+    // height 0 for cells outside the world
+    struct Sample {
+        int height;
+        int tile;
+    };
+
+    struct Mesh {
+        std::vector<int> vertices;
+        uint32_t columnFirst[REGION_COLUMNS];
+        uint32_t columnCount[REGION_COLUMNS];
+    };
+
+    struct Region {
+        int x0, z0;  // Block coordinates
+        std::unique_ptr<VertexBuffer> buffer;
+        uint32_t columnFirst[REGION_COLUMNS] = {};
+        uint32_t columnCount[REGION_COLUMNS] = {};
+        bool dirty = true;
+        bool pending = false;  // A build is queued or running
+    };
+
+    void scheduleBuild(ChunkMeshBuilder& builder, int index);
+    void captureSamples(const Region& region, std::vector<Sample>& samples) const;
+    void upload(int index, Mesh& mesh);
+
+    // Worker side: no level access, only the captured samples
+    static void buildMesh(TileRenderer& renderer, const std::vector<Sample>& samples,
+                          int x0, int z0, Mesh& mesh);
+
+    Level* level;
+    int xRegions, zRegions;
+    std::vector<Region> regions;
+
+    // Camera and distances (blocks) from the last update
+    double camX, camZ;
+    float detailDistance;
+    float farDistance;
+
+    std::vector<DrawIndexedCommand> drawCommands;
+};
+
+} // namespace mc
@@ -19,13 +19,17 @@ class IndexBuffer;
  * - Texture:  2 floats (8 bytes) at byte offset 12  - location 1
  * - Color:    4 bytes (RGBA) at byte offset 20      - location 2
  * - Normal:   4 bytes (3 signed bytes + padding) at byte offset 24 - location 3
- * - Light:    2 bytes (skyLight, blockLight) at byte offset 28 - location 4
- * - Padding:  2 bytes at byte offset 30
+ * - Light:    4 bytes (skyLight, blockLight, atlas tile, repeat flag) at byte offset 28 - location 4
  */
 class Tesselator {
 public:
     static Tesselator& getInstance();
 
+    // CPU-only instance for mesh worker threads: never touches the RenderDevice,
+    // grows its array instead of flushing, and is drained with getVertexData()
+    explicit Tesselator(bool cpuOnly);
+    ~Tesselator();
+
     // Lifecycle
     void init();
     void destroy();
@@ -47,6 +51,15 @@ public:
     void tex(double u, double v);
     void normal(float x, float y, float z);
     void lightLevel(int skyLight, int blockLight);  // Set light levels (0-15 each)
+    // Tag vertices as repeating terrain atlas tile textureIndex: UVs are then in
+    // block units and the world shader wraps them inside that tile (greedy
+    // merged faces). Pass -1 to go back to plain atlas UVs.
+    void repeatTexture(int textureIndex);
+    // Tag subsequent vertices with the cell their light was read from, so a
+    // chunk can patch light in place later. lightLevel() resets the tag to
+    // LIGHT_SOURCE_UNKNOWN. Tags are only recorded while tracking is on.
+    void lightSource(int cell);
+    void trackLightSources(bool track);
     void offset(double xo, double yo, double zo);
 
     // State management
@@ -59,36 +72,39 @@ public:
     // Stats
     int getVertexCount() const { return vertices; }
 
+    static constexpr int VERTEX_STRIDE = 8;      // 8 ints (32 bytes) per vertex
+    static constexpr int LIGHT_SOURCE_UNKNOWN = -1;
+
     // Data extraction for chunk building (returns data without drawing)
     struct VertexData {
         std::vector<int> vertices;
         std::vector<unsigned int> indices;
-        int vertexCount;
-        bool hasColor;
-        bool hasTexture;
-        bool hasNormal;
+        std::vector<int> lightSources;  // One tag per vertex, empty unless tracking
+        int vertexCount = 0;
+        bool hasColor = false;
+        bool hasTexture = false;
+        bool hasNormal = false;
     };
     VertexData getVertexData();
 
 private:
     Tesselator();
-    ~Tesselator();
     Tesselator(const Tesselator&) = delete;
     Tesselator& operator=(const Tesselator&) = delete;
 
     void draw();
-    void buildQuadIndices();
 
-    // RenderDevice buffers (used by both backends)
+    // RenderDevice buffers (used by both backends); vertices stream into a
+    // ring so consecutive draws append instead of reallocating the buffer
     std::unique_ptr<VertexBuffer> vertexBuffer;
-    std::unique_ptr<IndexBuffer> indexBuffer;
+    std::unique_ptr<IndexBuffer> indexBuffer;  // Shared triangle fan indices
     bool vaoInitialized;
+    int fanTriangles;  // Triangles covered by indexBuffer
 
     // Vertex data array (matches Java int[] array)
     static constexpr int MAX_VERTICES = 524288;
-    static constexpr int VERTEX_STRIDE = 8;      // 8 ints (32 bytes) per vertex
     std::vector<int> array;
-    std::vector<unsigned int> indices;
+    std::vector<unsigned int> indices;  // Scratch for building the fan index buffer
     int p;           // Current position in array (in ints)
     int vertices;    // Number of vertices added
     int count;       // Vertex count within current primitive
@@ -98,6 +114,9 @@ private:
     int col;
     int normalValue;
     int lightValue;  // Packed sky light (low byte) and block light (high byte)
+    int repeatValue; // Atlas tile (byte 2) and repeat flag (byte 3), 0 when off
+    int lightSourceValue;
+    std::vector<int> lightSources;
     double xo, yo, zo;
 
     // State flags
@@ -107,6 +126,8 @@ private:
     bool hasLight;
     bool noColorFlag;
     bool tesselating;
+    bool cpuOnly;
+    bool lightSourceTracking;
 
     DrawMode mode;
 };
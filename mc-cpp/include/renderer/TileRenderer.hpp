@@ -1,24 +1,40 @@
 #pragma once
 
 #include "world/tile/Tile.hpp"
+#include <vector>
+#include <cstdint>
 
 namespace mc {
 
 class Level;
 class Tesselator;
+class ChunkSnapshot;
 
 class TileRenderer {
 public:
     Level* level;
     bool renderAllFaces;
 
+    // Smooth lighting / ambient occlusion for cubes (C++ addition, off by default).
+    // Only takes effect while a light cache is built for the chunk being meshed.
+    bool smoothLighting;
+
     // Texture coordinates (for 256x256 terrain.png with 16x16 tiles)
     static constexpr int TILES_PER_ROW = 16;
     static constexpr float TILE_SIZE = 1.0f / 16.0f;
 
     TileRenderer();
+    // Render into a specific tesselator (mesh worker threads own their own)
+    explicit TileRenderer(Tesselator& tesselator);
     void setLevel(Level* level);
 
+    // Read blocks and light from a snapshot instead of the level while meshing
+    // a chunk (required off the main thread). Pass nullptr to go back to the level.
+    void setSnapshot(const ChunkSnapshot* snapshot);
+
+    // Tesselator this renderer emits into
+    Tesselator& getTesselator() { return t; }
+
     // Render a tile at world position
     bool renderTile(Tile* tile, int x, int y, int z);
     bool renderTileInWorld(int x, int y, int z);
@@ -39,6 +55,19 @@ public:
     void renderLiquid(Tile* tile, int x, int y, int z);
     void renderCactus(Tile* tile, int x, int y, int z);
 
+    // Greedy meshing for plain cubes (flat lighting only). A face key is 0 for
+    // a hidden face, otherwise it packs everything that decides the face's look
+    // (tile, sky and block light); faces with equal keys on the same plane can
+    // be drawn as one merged quad with a repeating texture.
+    bool canMergeFaces(Tile* tile) const;
+    uint32_t getCubeFaceKey(Tile* tile, int x, int y, int z, int face);
+    static int getTileIdFromFaceKey(uint32_t key) { return (key >> 8) & 255; }
+
+    // Draw a w x h run of merged faces whose min corner block is (x, y, z).
+    // w runs along the face's u axis and h along its v axis: x/z for down and
+    // up, x/y for north and south, z/y for west and east.
+    void renderMergedFace(Tile* tile, int face, int x, int y, int z, int w, int h);
+
     // Render individual faces
     void renderFaceDown(Tile* tile, double x, double y, double z, int texture);
     void renderFaceUp(Tile* tile, double x, double y, double z, int texture);
@@ -55,6 +84,11 @@ public:
     int getSkyLight(int x, int y, int z);
     int getBlockLight(int x, int y, int z);
 
+    // Per-chunk cell cache for smooth lighting. Every cell in the chunk and
+    // its border is sampled once here and shared by all face corners reading it.
+    void buildLightCache(int x0, int y0, int z0, int size);
+    void clearLightCache();
+
     // Check if a render shape can be rendered as a 3D block
     // (matches Java TileRenderer.canRender)
     static bool canRender(int renderShape);
@@ -66,6 +100,38 @@ private:
     // Check if face should be rendered (neighbor is transparent)
     bool shouldRenderFace(int x, int y, int z, int face);
 
+    // World reads used while meshing: the snapshot if one is set, else the level
+    bool hasWorld() const;
+    Tile* tileAt(int x, int y, int z) const;
+    int dataAt(int x, int y, int z) const;
+
+    // Flat light for following vertices from one cell, tagged with that cell
+    // when meshing from a snapshot so Chunk can patch it in place later
+    void flatLight(int x, int y, int z);
+
+    // Emit a face vertex; when smoothFace is set, lights it from the cells on
+    // the lit side of the face around that corner
+    void vertexUV(double x, double y, double z, float u, float v);
+
+    // Following vertices belong to face (0-5, as shouldRenderFace) of block
+    // (x, y, z) and are smooth lit
+    void beginSmoothFace(int x, int y, int z, int face);
+
+    // Packed cell from the cache (world coordinates, chunk plus border)
+    uint16_t cachedCell(int x, int y, int z) const;
+
+    std::vector<uint16_t> cellCache;       // (size+2)^3 cells, packed sky/block/opaque
+    int cacheX0, cacheY0, cacheZ0;
+    int cacheSize;                         // 0 when no cache is built
+
+    // State for the face currently being emitted with smooth lighting
+    bool smoothFace;
+    int faceX, faceY, faceZ;
+    int faceNormal[3];
+    float faceR, faceG, faceB;
+
+    const ChunkSnapshot* snapshot;
+
     Tesselator& t;
 };
 
@@ -84,6 +84,15 @@ public:
      */
     virtual void swapBuffers() = 0;
 
+    /**
+     * Request an offscreen (hidden) window. Must be called before
+     * configureWindowHints(). The frames go to the device's offscreen target.
+     *
+     * For OpenGL: Hides the window and skips buffer swaps
+     * For Metal: Not supported, ignored
+     */
+    virtual void setOffscreen(bool enabled) { (void)enabled; }
+
     /**
      * Get the GLFW window handle.
      */
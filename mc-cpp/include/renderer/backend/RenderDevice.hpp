@@ -1,10 +1,12 @@
 #pragma once
 
 #include "RenderTypes.hpp"
+#include "RenderStateCache.hpp"
 #include "ShaderPipeline.hpp"
 #include "VertexBuffer.hpp"
 #include "Texture.hpp"
 #include <memory>
+#include <string>
 
 namespace mc {
 
@@ -48,6 +50,9 @@ public:
     // Color mask (for depth-only passes)
     virtual void setColorMask(bool r, bool g, bool b, bool a) = 0;
 
+    // Per-frame shader constants (FrameUniforms block), bound for every shader
+    virtual void setFrameUniforms(const FrameUniforms& uniforms) = 0;
+
     // Factory methods
     virtual std::unique_ptr<ShaderPipeline> createShaderPipeline() = 0;
     virtual std::unique_ptr<VertexBuffer> createVertexBuffer() = 0;
@@ -58,19 +63,73 @@ public:
     virtual void draw(PrimitiveType primitive, size_t vertexCount, size_t startVertex = 0) = 0;
     virtual void drawIndexed(PrimitiveType primitive, size_t indexCount, size_t startIndex = 0) = 0;
 
+    // Issue a list of indexed draws from the bound vertex and index buffers,
+    // in order. One indirect call where the API supports it, a loop otherwise.
+    virtual void multiDrawIndexed(PrimitiveType primitive, const DrawIndexedCommand* commands,
+                                  size_t count) = 0;
+
     // Setup vertex attributes for the standard vertex format
     virtual void setupVertexAttributes() = 0;
 
+    // Setup vertex attributes for the packed chunk format (ChunkVertexFormat),
+    // with per-draw chunk origins read from drawData at each draw's base instance
+    virtual void setupChunkVertexAttributes(VertexBuffer* drawData) = 0;
+
+    // Setup vertex attributes for particle billboards (ParticleVertexFormat):
+    // corners from the bound buffer, one instance per particle from instances
+    virtual void setupParticleVertexAttributes(VertexBuffer* instances) = 0;
+
+    // Setup vertex attributes for entity models (ModelVertexFormat): the
+    // standard format from the bound buffer, part instances from instances
+    // starting at each draw's base instance
+    virtual void setupModelVertexAttributes(VertexBuffer* instances) = 0;
+
+    // Shared index buffer for quad lists: quad i is drawn as triangles
+    // (4i, 4i+1, 4i+2) and (4i, 4i+2, 4i+3). Grown on demand to hold at least
+    // quadCount quads, so quad meshes draw with it instead of uploading their
+    // own indices. Fetch it before binding a vertex buffer (growing it uploads).
+    IndexBuffer* getQuadIndexBuffer(size_t quadCount);
+
     // Vsync control (Metal-specific, OpenGL uses glfwSwapInterval)
     virtual void setVsync(bool enabled) { (void)enabled; }
 
+    // Render into a width x height offscreen target instead of the window;
+    // call again to resize it. Returns false if the backend has no offscreen
+    // mode or the target can't be created.
+    virtual bool setOffscreen(int width, int height) { (void)width; (void)height; return false; }
+
+    // Draw into texture (its full size, with a depth buffer) instead of the
+    // frame target until endRenderToTexture(), which restores the target and
+    // viewport. Returns false if the backend can't render to textures.
+    virtual bool beginRenderToTexture(Texture* texture) { (void)texture; return false; }
+    virtual void endRenderToTexture() {}
+
+    // While offscreen, write every interval-th presented frame to
+    // directory/frame_<n>.png, reading it back without stalling the frame
+    // (0 turns capture off)
+    virtual void setFrameCapture(int interval, const std::string& directory) {
+        (void)interval;
+        (void)directory;
+    }
+
     // Singleton access
     static RenderDevice& get();
     static void setInstance(std::unique_ptr<RenderDevice> device);
     static bool hasInstance();
 
+protected:
+    // Called from shutdown() while the graphics API is still alive
+    void releaseQuadIndexBuffer();
+
+    // State last sent by this backend, for its setters and its resources'
+    // binds to filter redundant calls through
+    RenderStateCache stateCache;
+
 private:
     static std::unique_ptr<RenderDevice> instance;
+
+    std::unique_ptr<IndexBuffer> quadIndexBuffer;
+    size_t quadIndexCapacity = 0;  // In quads
 };
 
 // Factory function - implemented per-backend
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "RenderTypes.hpp"
+#include <cstdint>
+
+namespace mc {
+
+// Shadow copy of the state a backend last sent to the graphics API. Each
+// setter records the new value and returns true only if it differs, so the
+// backend can drop the redundant call. Everything starts unknown (and is
+// sent) until set once; invalidate() returns to that after state was changed
+// behind the cache's back. Programs and textures are identified by backend
+// object names.
+class RenderStateCache {
+public:
+    static constexpr int MAX_TEXTURE_UNITS = 8;
+
+    enum class Capability { DepthTest, CullFace, Blend, PolygonOffset, Count };
+
+    void invalidate();
+
+    bool setEnabled(Capability cap, bool enabled);
+    bool setDepthWrite(bool enabled);
+    bool setDepthFunc(CompareFunc func);
+    bool setCullMode(CullMode mode);
+    bool setFrontFace(FrontFace face);
+    bool setBlendFunc(BlendFactor src, BlendFactor dst);
+    bool setPolygonOffset(float factor, float units);
+    bool setLineWidth(float width);
+    bool setColorMask(bool r, bool g, bool b, bool a);
+
+    bool useProgram(uint32_t program);
+    bool setActiveTexture(int unit);
+    bool bindTexture(int unit, uint32_t texture);
+
+    // Active texture unit, or 0 if unknown
+    int getActiveTexture() const { return activeTexture.known ? activeTexture.value : 0; }
+
+    // The object was deleted: units it was bound to now hold 0 (textures),
+    // the current program is no longer known (programs)
+    void forgetProgram(uint32_t program);
+    void forgetTexture(uint32_t texture);
+
+private:
+    template <typename T>
+    struct Cached {
+        T value{};
+        bool known = false;
+
+        bool set(const T& v) {
+            if (known && value == v) return false;
+            value = v;
+            known = true;
+            return true;
+        }
+    };
+
+    struct BlendFunc {
+        BlendFactor src, dst;
+        bool operator==(const BlendFunc&) const = default;
+    };
+    struct PolygonOffset {
+        float factor, units;
+        bool operator==(const PolygonOffset&) const = default;
+    };
+
+    Cached<bool> enabled[static_cast<int>(Capability::Count)];
+    Cached<bool> depthWrite;
+    Cached<CompareFunc> depthFunc;
+    Cached<CullMode> cullMode;
+    Cached<FrontFace> frontFace;
+    Cached<BlendFunc> blendFunc;
+    Cached<PolygonOffset> polygonOffset;
+    Cached<float> lineWidth;
+    Cached<uint8_t> colorMask;  // RGBA bits
+    Cached<uint32_t> program;
+    Cached<int> activeTexture;
+    Cached<uint32_t> textures[MAX_TEXTURE_UNITS];
+};
+
+} // namespace mc
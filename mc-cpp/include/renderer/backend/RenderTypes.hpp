@@ -86,7 +86,78 @@ struct VertexFormat {
     static constexpr int ATTRIB_TEXCOORD = 1;  // 2 floats, offset 12
     static constexpr int ATTRIB_COLOR = 2;     // 4 bytes normalized, offset 20
     static constexpr int ATTRIB_NORMAL = 3;    // 3 bytes + 1 pad, offset 24
-    static constexpr int ATTRIB_LIGHT = 4;     // 2 bytes + 2 pad, offset 28
+    static constexpr int ATTRIB_LIGHT = 4;     // 4 bytes (sky, block, atlas tile, repeat), offset 28
+};
+
+// Packed chunk vertex (12 bytes, three uints) decoded by chunk.vert. Positions
+// are relative to the chunk origin, a per-draw attribute read from a separate
+// draw-data buffer (one DRAW_DATA_STRIDE entry per chunk, selected by the
+// draw's base instance).
+//   word 0: x (15 bits) | y (15 bits) << 15 | repeat flag << 30 | grass tint << 31
+//   word 1: z (15 bits) | u (16 bits) << 16
+//   word 2: v (16 bits) | sky light << 16 | block light << 20 | shade << 24
+// Positions store (p + POSITION_BIAS) * POSITION_SCALE: -8..24 blocks in 1/1024
+// steps. Plain UVs store atlas UV * UV_SCALE; repeating UVs (greedy merged
+// faces) store (atlas column or row * 32 + block units) * REPEAT_UV_SCALE.
+// Color is a grey shade, optionally times the fixed grass tint.
+struct ChunkVertexFormat {
+    static constexpr size_t STRIDE = 12;
+    static constexpr int ATTRIB_PACKED = 0;  // 3 uints, offset 0
+    static constexpr int ATTRIB_ORIGIN = 1;  // 3 floats per draw, offset 0 of draw data
+
+    static constexpr size_t DRAW_DATA_STRIDE = 16;
+
+    static constexpr float POSITION_SCALE = 1024.0f;
+    static constexpr float POSITION_BIAS = 8.0f;
+    static constexpr float UV_SCALE = 65535.0f;
+    static constexpr float REPEAT_UV_SCALE = 128.0f;
+};
+
+// Particle billboards (particle.vert): a 4-vertex quad of corners drawn with
+// the shared quad indices, instanced once per particle. Instances hold the
+// world position and half size, an RGBA8 color and the particles.png tile.
+struct ParticleVertexFormat {
+    static constexpr size_t CORNER_STRIDE = 8;
+    static constexpr int ATTRIB_CORNER = 0;         // 2 floats (-1 or 1), offset 0
+    static constexpr int ATTRIB_POSITION_SIZE = 1;  // 4 floats per instance, offset 0
+    static constexpr int ATTRIB_COLOR = 2;          // 4 bytes normalized per instance, offset 16
+    static constexpr int ATTRIB_TILE = 3;           // 1 float per instance, offset 20
+
+    static constexpr size_t INSTANCE_STRIDE = 24;
+};
+
+// Entity models (model.vert): compiled ModelPart cubes in the standard vertex
+// format, instanced once per entity part. Instances hold the part's model
+// matrix as four columns, an RGBA8 color and the light at the entity.
+struct ModelVertexFormat {
+    static constexpr int ATTRIB_TRANSFORM = 5;  // 4 float4 columns per instance (5-8), offset 0
+    static constexpr int ATTRIB_COLOR = 9;      // 4 bytes normalized per instance, offset 64
+    static constexpr int ATTRIB_LIGHT = 10;     // 4 bytes per instance (sky, block), offset 68
+
+    static constexpr size_t INSTANCE_STRIDE = 72;
+};
+
+// Constants shared by every shader using world.frag for the whole frame
+// (the FrameUniforms block, std140 at binding 3), so they are uploaded when
+// they change rather than set on each shader
+struct FrameUniforms {
+    static constexpr int BINDING = 3;
+
+    float fogColor[3];
+    float fogStart;
+    float fogEnd;
+    float skyBrightness;
+    float padding[2];  // std140 rounds the block to 16 bytes
+};
+
+// One draw of a multi-draw, laid out like GL's DrawElementsIndirectCommand so
+// it can be uploaded to an indirect buffer as is
+struct DrawIndexedCommand {
+    uint32_t indexCount;
+    uint32_t instanceCount;
+    uint32_t firstIndex;
+    int32_t baseVertex;     // Added to every index
+    uint32_t baseInstance;  // Selects the per-draw attributes
 };
 
 } // namespace mc
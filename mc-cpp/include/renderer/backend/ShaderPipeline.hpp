@@ -5,6 +5,10 @@
 
 namespace mc {
 
+// A uniform resolved once by name; -1 when the shader has no such uniform,
+// in which case setting it does nothing
+using UniformHandle = int;
+
 class ShaderPipeline {
 public:
     virtual ~ShaderPipeline() = default;
@@ -16,14 +20,18 @@ public:
     virtual void bind() = 0;
     virtual void unbind() = 0;
 
-    // Uniform setters
-    virtual void setInt(const std::string& name, int value) = 0;
-    virtual void setFloat(const std::string& name, float value) = 0;
-    virtual void setVec2(const std::string& name, float x, float y) = 0;
-    virtual void setVec3(const std::string& name, float x, float y, float z) = 0;
-    virtual void setVec4(const std::string& name, float x, float y, float z, float w) = 0;
-    virtual void setMat3(const std::string& name, const float* matrix) = 0;
-    virtual void setMat4(const std::string& name, const float* matrix) = 0;
+    // Resolve a uniform after loading. Uniforms are resolved at link time, so
+    // this is a lookup; keep the handle rather than calling it per draw.
+    virtual UniformHandle getUniform(const std::string& name) = 0;
+
+    // Uniform setters. A value equal to the one last set is not re-uploaded.
+    virtual void setInt(UniformHandle uniform, int value) = 0;
+    virtual void setFloat(UniformHandle uniform, float value) = 0;
+    virtual void setVec2(UniformHandle uniform, float x, float y) = 0;
+    virtual void setVec3(UniformHandle uniform, float x, float y, float z) = 0;
+    virtual void setVec4(UniformHandle uniform, float x, float y, float z, float w) = 0;
+    virtual void setMat3(UniformHandle uniform, const float* matrix) = 0;
+    virtual void setMat4(UniformHandle uniform, const float* matrix) = 0;
 
     virtual bool isValid() const = 0;
 };
@@ -16,6 +16,19 @@ public:
     // Upload vertex data
     virtual void upload(const void* data, size_t sizeBytes, BufferUsage usage) = 0;
 
+    // Overwrite part of an already allocated buffer (upload(nullptr, ...) allocates)
+    virtual void uploadRange(const void* data, size_t offsetBytes, size_t sizeBytes) = 0;
+
+    // Copy the first sizeBytes of another buffer of the same backend to the start of this one
+    virtual void copyFrom(const VertexBuffer& source, size_t sizeBytes) = 0;
+
+    // Streaming ring: append data behind what earlier stream() calls wrote and
+    // return the byte offset it landed at (a multiple of alignment, so draws can
+    // address it by base vertex). Appended ranges are never overwritten; when
+    // the buffer is full it gets fresh storage and filling restarts at 0, while
+    // draws already issued keep reading the old one. Don't mix with upload().
+    virtual size_t stream(const void* data, size_t sizeBytes, size_t alignment) = 0;
+
     // Binding for rendering
     virtual void bind() = 0;
     virtual void unbind() = 0;
@@ -1,11 +1,10 @@
 #pragma once
 
 #include "renderer/model/ModelPart.hpp"
+#include "renderer/model/ModelBatch.hpp"
 
 namespace mc {
 
-class Tesselator;
-
 // Chicken model matching Java ChickenModel
 class ChickenModel {
 public:
@@ -18,6 +17,10 @@ public:
     ModelPart wing0;
     ModelPart wing1;
 
+    // Every chicken drawn this frame: queue each with its pose after
+    // setupAnim, then flush once
+    ModelBatch batch;
+
     ChickenModel();
 
     // Set up animation poses
@@ -27,12 +30,6 @@ public:
     // yRot: head yaw rotation (degrees)
     // xRot: head pitch rotation (degrees)
     void setupAnim(float time, float walkSpeed, float bob, float yRot, float xRot);
-
-    // Render the model
-    void render(Tesselator& t, float scale);
-    void render(Tesselator& t, float scale, float r, float g, float b, float a);
-    void render(Tesselator& t, float scale, int skyLight, int blockLight);
-    void render(Tesselator& t, float scale, float r, float g, float b, float a, int skyLight, int blockLight);
 };
 
 } // namespace mc
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "renderer/backend/RenderTypes.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace mc {
+
+class ModelPart;
+class VertexBuffer;
+
+// Draws every entity of one model type together. The parts' cubes are
+// compiled once into a static mesh; each frame, add() queues one instance
+// per visible part with that part's current pose, and flush() draws each
+// part's quads instanced over all queued entities in one multi-draw.
+class ModelBatch {
+public:
+    // parts must outlive the batch; scale is the model's pixel size (1/16)
+    ModelBatch(std::vector<ModelPart*> parts, float scale);
+    ~ModelBatch();
+
+    // Queue the parts, posed as they are now, under the entity transform
+    void add(const glm::mat4& transform, float r, float g, float b, float a, int skyLight, int blockLight);
+    // Queue the same way for flushOverlay() (hurt flash)
+    void addOverlay(const glm::mat4& transform, float r, float g, float b, float a, int skyLight, int blockLight);
+
+    bool empty() const { return queued.empty() && overlay.empty(); }
+
+    // Draw and clear the queued instances with the bound shader, texture
+    // and state
+    void flush();
+    void flushOverlay();
+
+private:
+    struct Instance {
+        float transform[16];
+        uint32_t color;     // RGBA8
+        uint8_t light[4];   // sky, block
+    };
+
+    // Instances are recorded entity by entity, one per visible part
+    struct Queue {
+        std::vector<uint8_t> parts;  // Part index of each instance
+        std::vector<Instance> instances;
+        bool empty() const { return instances.empty(); }
+    };
+
+    void queue(Queue& target, const glm::mat4& transform, float r, float g, float b, float a,
+               int skyLight, int blockLight);
+    void draw(Queue& source);
+    void compile();
+
+    std::vector<ModelPart*> parts;
+    float scale;
+
+    Queue queued;
+    Queue overlay;
+
+    // Staging for the draw: instances grouped by part, one command per part
+    std::vector<Instance> sorted;
+    std::vector<uint32_t> partOffsets;
+    std::vector<DrawIndexedCommand> commands;
+
+    std::unique_ptr<VertexBuffer> mesh;
+    std::unique_ptr<VertexBuffer> instanceBuffer;
+    std::vector<int> firstQuads;  // Per part, into mesh
+    int meshQuads = 0;
+};
+
+} // namespace mc
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <glm/glm.hpp>
 #include <vector>
 
 namespace mc {
@@ -37,10 +38,14 @@ public:
     // Set position offset
     void setPos(float x, float y, float z);
 
-    // Render this model part
-    void render(Tesselator& t, float scale);
-    void render(Tesselator& t, float scale, float r, float g, float b, float a);
-    void render(Tesselator& t, float scale, float r, float g, float b, float a, int skyLight, int blockLight);
+    // Append this part's quads to t, begun in Quads mode, at the given scale.
+    // Like Java's display-list compile: done once, the pose is applied per
+    // instance through getTransform.
+    void compile(Tesselator& t, float scale) const;
+    int getQuadCount() const { return static_cast<int>(quads.size()); }
+
+    // Parent transform moved to this part's position and rotation
+    glm::mat4 getTransform(const glm::mat4& parent, float scale) const;
 
 private:
     // Texture coordinates (in 64x32 texture)
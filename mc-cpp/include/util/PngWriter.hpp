@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace mc {
+
+// Minimal PNG encoder for frame captures: 8-bit RGBA, no filtering, and
+// stored (uncompressed) deflate blocks, so it needs no zlib
+class PngWriter {
+public:
+    // rgba is width * height * 4 bytes, top row first. Returns false if the
+    // file can't be written.
+    static bool write(const std::string& path, int width, int height, const uint8_t* rgba);
+
+private:
+    static uint32_t crc32(uint32_t crc, const uint8_t* data, size_t length);
+};
+
+} // namespace mc
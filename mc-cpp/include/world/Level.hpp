@@ -44,6 +44,11 @@ public:
     std::vector<uint8_t> blockLight;
     std::vector<int> heightMap;
 
+    // Non-air block count per CHUNK_SIZE^3 section, so meshing can skip
+    // sections that are uniform air. Kept current by setTile/setTileWithData;
+    // code that writes blocks[] directly must call recountSections afterwards.
+    std::vector<uint16_t> sectionBlockCounts;
+
     // Entities
     std::vector<std::unique_ptr<Entity>> entities;
     std::vector<Player*> players;
@@ -73,6 +78,10 @@ public:
     // Block access
     int getTile(int x, int y, int z) const;
     bool setTile(int x, int y, int z, int tileId);
+
+    // True if the section containing block (x, y, z) holds only air
+    bool isSectionEmpty(int x, int y, int z) const;
+    void recountSections();
     bool setTileWithData(int x, int y, int z, int tileId, int metadata);
     int getData(int x, int y, int z) const;
     bool setData(int x, int y, int z, int metadata);
@@ -98,7 +107,8 @@ public:
     float getSkyBrightness() const;  // Sky brightness factor (0-1) based on time of day
     float getBrightness(int x, int y, int z) const;
     float getBrightnessForChunk(int x, int y, int z) const;  // Always uses skyDarken=0 for chunk building
-    void updateLightAt(int x, int y, int z);
+    void updateLightAt(int x, int y, int z);  // Journals the change until the next flush
+    void flushLightUpdates();  // Relight journaled changes now (before chunk rebuilds)
     void updateLights();
 
     // Height map
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace mc {
+
+class Level;
+
+// Lighting correctness oracle and throughput benchmark (run with --light-bench).
+// Replays the same randomized edit sequences on a fresh Level through each
+// LightingEngine update path, compares every cell against a naive full-level
+// recompute at regular checkpoints and reports edits/sec and BFS nodes/sec.
+// Every mode runs twice: on edits scattered over the whole level and on
+// edits clustered per tick the way a player builds and digs.
+class LightingBenchmark {
+public:
+    struct Config {
+        int width = 64;
+        int height = 64;
+        int depth = 64;
+        int edits = 2000;
+        int checkInterval = 250;  // Compare against the reference every N edits
+        int editsPerTick = 16;    // Journaled mode flushes once per this many edits
+        uint32_t seed = 12345;
+    };
+
+    // Update paths that can be benchmarked
+    enum class Mode {
+        Immediate,  // queueUpdateAt per edit
+        Journaled,  // journalUpdateAt per edit, flushed once per tick (what Level::setTile does);
+                    // only faster than Immediate on clustered edits
+        Queued,     // Region updates drained with processUpdates after each edit
+        Parallel    // Region updates drained by the worker threads
+    };
+
+    // Where each tick's edits land
+    enum class EditPattern {
+        Scattered,  // Uniformly over the level, so nothing in a tick overlaps
+        Clustered   // One burst per tick: a small box inside one chunk, or a column fill
+    };
+
+    // Runs every mode, returns true if all of them matched the reference
+    static bool run(const Config& config);
+
+    // Naive reference: iterate calculateLightAt's rule over the whole level
+    // until nothing changes. Slow, but has no incremental state to get wrong.
+    static void computeReference(const Level& level,
+                                 std::vector<uint8_t>& skyLight,
+                                 std::vector<uint8_t>& blockLight);
+
+    // Hills, caves, pools and leaf canopies, fully lit (also used by the
+    // render benchmark)
+    static void generateTerrain(Level& level, uint32_t seed);
+
+private:
+    struct Edit {
+        int x, y, z;
+        int tileId;
+    };
+
+    static const char* getModeName(Mode mode);
+    static const char* getPatternName(EditPattern pattern);
+    static std::vector<Edit> generateEdits(const Config& config, EditPattern pattern);
+    static void applyEdit(Level& level, const Edit& edit, Mode mode);
+    static bool settle(Level& level, Mode mode);
+    static bool runMode(const Config& config, Mode mode, const std::vector<Edit>& edits,
+                        double& editsPerSec);
+    static bool compare(const Level& level, const std::vector<uint8_t>& skyLight,
+                        const std::vector<uint8_t>& blockLight, int editCount);
+};
+
+} // namespace mc
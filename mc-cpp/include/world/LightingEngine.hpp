@@ -7,6 +7,9 @@
 #include <thread>
 #include <condition_variable>
 #include <functional>
+#include <unordered_set>
+#include <tuple>
+#include <cstdint>
 
 namespace mc {
 
@@ -50,6 +53,22 @@ public:
     // Queue light update at a single block position
     void queueUpdateAt(int x, int y, int z);
 
+    // Record a changed block in the per-tick journal instead of relighting now.
+    // Positions are deduplicated; flushJournal relights all of them at once.
+    // Worth it when a tick's edits overlap (digging out a room, filling a
+    // column): they share the darkening pass, the per-column sky scan and the
+    // relight, which --light-bench measures at over 2x queueUpdateAt. Edits
+    // that are isolated from each other gain nothing; use queueUpdateAt when
+    // the new light must be readable before the end of the tick.
+    void journalUpdateAt(int x, int y, int z);
+
+    // Relight every journaled position with one combined remove-then-add pass
+    // per layer (call once per tick, and before chunks are rebuilt)
+    void flushJournal();
+
+    // Number of distinct positions waiting in the journal
+    size_t getJournalSize() const { return journal.size(); }
+
     // Process pending light updates (call from main thread, processes up to maxUpdates)
     void processUpdates(int maxUpdates = 500);
 
@@ -72,6 +91,13 @@ public:
     // Get number of pending updates
     size_t getPendingUpdateCount() const;
 
+    // True when the queue is empty and no worker is mid-update
+    bool isIdle() const;
+
+    // Cells visited by BFS and region passes since the last reset (for benchmarking)
+    uint64_t getNodesVisited() const { return nodesVisited.load(std::memory_order_relaxed); }
+    void resetStats() { nodesVisited = 0; }
+
 private:
     Level* level;
 
@@ -85,6 +111,23 @@ private:
     std::atomic<bool> running;
     std::condition_variable workAvailable;
     std::mutex workMutex;
+    std::atomic<int> activeWorkers;
+
+    // Per-tick light change journal (main thread only): level indices in
+    // insertion order, plus a set for deduplication
+    std::vector<int> journal;
+    std::unordered_set<int> journalSet;
+
+    // Per-section, per-column "directly sky-exposed" bits (y >= heightmap), one
+    // word per SECTION_HEIGHT cells, indexed (section * depth + z) * width + x.
+    // Diffing against the heightmap after an edit gives exactly the cells that
+    // became or stopped being sky sources.
+    static constexpr int SECTION_HEIGHT = 16;
+    std::vector<uint16_t> skyExposure;
+    int skyExposureSections;
+
+    // Stats
+    std::atomic<uint64_t> nodesVisited;
 
     // Worker thread function
     void workerFunction();
@@ -113,6 +156,16 @@ private:
     // Check if position is sky-lit (above heightmap)
     bool isSkyLit(int x, int y, int z);
 
+    // Exposure bits of one section for a column with the given heightmap value
+    static uint16_t skyExposureBits(int height, int section);
+
+    // Recompute every column's exposure bits from the heightmap
+    void rebuildSkyExposure();
+
+    // Re-derive column (x, z) from the heightmap, appending the y of every cell
+    // that stopped (lostY) or started (gainedY) being directly sky-exposed
+    void updateSkyExposure(int x, int z, std::vector<int>& lostY, std::vector<int>& gainedY);
+
     // Update light if different from expected value
     void updateLightIfOtherThan(LightLayer layer, int x, int y, int z, int expectedValue);
 
@@ -122,12 +175,20 @@ private:
     // Propagate sky light to a neighbor (for horizontal propagation under overhangs)
     void propagateSkyLightTo(int x, int y, int z, int lightLevel);
 
-    // Immediate BFS propagation from a position (for instant light updates)
+    // Immediate propagation from a position (for instant light updates)
     void propagateLightImmediateBFS(LightLayer layer, int startX, int startY, int startZ);
 
     // Remove light when a source is removed (darkness propagation)
     void removeLightBFS(LightLayer layer, int startX, int startY, int startZ, int oldLightValue);
 
+    // Darkness propagation from many seeds (x, y, z, old light) at once; cells lit by
+    // surviving sources at the edge of the darkened area are appended to readdSeeds
+    void removeLightMultiBFS(LightLayer layer, std::vector<std::tuple<int, int, int, int>>& seeds,
+                             std::vector<std::tuple<int, int, int>>& readdSeeds);
+
+    // Relax light outward from many seeds at once until nothing changes
+    void propagateLightFromSeeds(LightLayer layer, const std::vector<std::tuple<int, int, int>>& seeds);
+
     // Recursive limit for light propagation
     static constexpr int MAX_RECURSE = 50;
     int recurseCount;
@@ -0,0 +1,56 @@
+#version 450 core
+
+// Chunk terrain vertex shader: decodes the packed 12-byte ChunkVertexFormat
+// (see RenderTypes.hpp) and feeds world.frag the same varyings as world.vert
+layout(location = 0) in uvec3 aPacked;
+layout(location = 1) in vec3 aChunkOrigin;  // Per draw (instanced)
+
+layout(binding = 0) uniform Uniforms {
+    mat4 uMVP;
+    mat4 uModelView;
+};
+
+layout(location = 0) out vec2 vTexCoord;
+layout(location = 1) out vec4 vColor;
+layout(location = 2) out vec3 vNormal;
+layout(location = 3) out vec3 vViewNormal;
+layout(location = 4) out vec2 vLight;  // skyLight, blockLight (0-15)
+layout(location = 5) out float vFogDepth;
+layout(location = 6) out vec2 vRepeat;  // atlas tile, repeat flag (greedy merged faces)
+
+void main() {
+    uint w0 = aPacked.x;
+    uint w1 = aPacked.y;
+    uint w2 = aPacked.z;
+
+    vec3 local = vec3(float(w0 & 0x7FFFu), float((w0 >> 15) & 0x7FFFu), float(w1 & 0x7FFFu));
+    vec3 position = aChunkOrigin + local / 1024.0 - 8.0;
+
+    gl_Position = uMVP * vec4(position, 1.0);
+    vec4 viewPos = uModelView * vec4(position, 1.0);
+    vFogDepth = length(viewPos.xyz);
+
+    vec2 uv = vec2(float(w1 >> 16), float(w2 & 0xFFFFu));
+    if ((w0 & 0x40000000u) != 0u) {
+        // Repeating UVs: atlas column/row * 32 + block units
+        uv /= 128.0;
+        vec2 tileXY = floor(uv / 32.0);
+        vTexCoord = uv - tileXY * 32.0;
+        vRepeat = vec2(tileXY.y * 16.0 + tileXY.x, 1.0);
+    } else {
+        vTexCoord = uv / 65535.0;
+        vRepeat = vec2(0.0);
+    }
+
+    // Grey face shade, times the fixed grass tint for grass tops
+    vec3 color = vec3(float(w2 >> 24) / 255.0);
+    if ((w0 & 0x80000000u) != 0u) {
+        color *= vec3(0.486, 0.741, 0.420);
+    }
+    vColor = vec4(color, 1.0);
+
+    // Terrain is lit from the light bytes, not normals
+    vNormal = vec3(0.0, 1.0, 0.0);
+    vViewNormal = vec3(0.0, 1.0, 0.0);
+    vLight = vec2(float((w2 >> 16) & 15u), float((w2 >> 20) & 15u));
+}
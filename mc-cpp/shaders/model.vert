@@ -0,0 +1,43 @@
+#version 450 core
+
+// Entity model vertex shader: compiled ModelPart cubes in the standard vertex
+// format, instanced once per entity part (see ModelVertexFormat in
+// RenderTypes.hpp), feeding world.frag the same varyings as world.vert
+layout(location = 0) in vec3 aPosition;
+layout(location = 1) in vec2 aTexCoord;
+layout(location = 5) in vec4 aTransform0;  // Per part: model matrix columns
+layout(location = 6) in vec4 aTransform1;
+layout(location = 7) in vec4 aTransform2;
+layout(location = 8) in vec4 aTransform3;
+layout(location = 9) in vec4 aColor;       // Per part
+layout(location = 10) in vec4 aLight;      // Per part: skyLight, blockLight (0-15)
+
+layout(binding = 0) uniform Uniforms {
+    mat4 uMVP;
+    mat4 uModelView;
+};
+
+layout(location = 0) out vec2 vTexCoord;
+layout(location = 1) out vec4 vColor;
+layout(location = 2) out vec3 vNormal;
+layout(location = 3) out vec3 vViewNormal;
+layout(location = 4) out vec2 vLight;  // skyLight, blockLight (0-15)
+layout(location = 5) out float vFogDepth;
+layout(location = 6) out vec2 vRepeat;  // atlas tile, repeat flag (greedy merged faces)
+
+void main() {
+    mat4 transform = mat4(aTransform0, aTransform1, aTransform2, aTransform3);
+    vec4 position = transform * vec4(aPosition, 1.0);
+
+    gl_Position = uMVP * position;
+    vec4 viewPos = uModelView * position;
+    vFogDepth = length(viewPos.xyz);
+    vTexCoord = aTexCoord;
+    vColor = aColor;
+
+    // Model cubes carry no normals; only the light level shades them
+    vNormal = vec3(0.0);
+    vViewNormal = vec3(0.0);
+    vLight = aLight.xy;
+    vRepeat = vec2(0.0);
+}
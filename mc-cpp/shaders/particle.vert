@@ -0,0 +1,46 @@
+#version 450 core
+
+// Particle billboard vertex shader: one instance per particle (see
+// ParticleVertexFormat in RenderTypes.hpp), expanded from a shared quad of
+// corners, feeding world.frag the same varyings as world.vert
+layout(location = 0) in vec2 aCorner;        // -1 or 1 along each billboard axis
+layout(location = 1) in vec4 aPositionSize;  // Per particle: world position, half size
+layout(location = 2) in vec4 aColor;         // Per particle, brightness applied
+layout(location = 3) in float aTile;         // Per particle: particles.png tile (16x16 grid)
+
+layout(binding = 0) uniform Uniforms {
+    mat4 uMVP;
+    mat4 uModelView;
+    vec3 uBillboardRight;  // Camera-facing axes in world space
+    vec3 uBillboardUp;
+};
+
+layout(location = 0) out vec2 vTexCoord;
+layout(location = 1) out vec4 vColor;
+layout(location = 2) out vec3 vNormal;
+layout(location = 3) out vec3 vViewNormal;
+layout(location = 4) out vec2 vLight;  // skyLight, blockLight (0-15)
+layout(location = 5) out float vFogDepth;
+layout(location = 6) out vec2 vRepeat;  // atlas tile, repeat flag (greedy merged faces)
+
+void main() {
+    vec3 position = aPositionSize.xyz +
+        (aCorner.x * uBillboardRight + aCorner.y * uBillboardUp) * aPositionSize.w;
+
+    gl_Position = uMVP * vec4(position, 1.0);
+    vec4 viewPos = uModelView * vec4(position, 1.0);
+    vFogDepth = length(viewPos.xyz);
+
+    // Tile minus a small gap so neighbouring tiles don't bleed in; the
+    // negative corner takes the far edge, as the Tesselator billboards did
+    vec2 tileOrigin = vec2(mod(aTile, 16.0), floor(aTile / 16.0)) / 16.0;
+    vTexCoord = tileOrigin + (1.0 - aCorner) * 0.5 * 0.0624375;
+
+    vColor = aColor;
+
+    // Lit on the CPU: full light here leaves the color as is
+    vNormal = vec3(0.0, 1.0, 0.0);
+    vViewNormal = vec3(0.0, 1.0, 0.0);
+    vLight = vec2(15.0, 15.0);
+    vRepeat = vec2(0.0);
+}
@@ -6,13 +6,11 @@ layout(location = 2) in vec3 vNormal;
 layout(location = 3) in vec3 vViewNormal;
 layout(location = 4) in vec2 vLight;  // skyLight, blockLight (0-15)
 layout(location = 5) in float vFogDepth;
+layout(location = 6) in vec2 vRepeat;  // atlas tile, repeat flag (greedy merged faces)
 
 layout(binding = 1) uniform sampler2D uTexture;
 
 layout(binding = 2) uniform FragUniforms {
-    vec3 uFogColor;
-    float uFogStart;
-    float uFogEnd;
     float uAlphaTest;
     int uUseTexture;
     int uEnableLighting;
@@ -21,6 +19,13 @@ layout(binding = 2) uniform FragUniforms {
     float uAmbient;
     float uDiffuse;
     float uBrightness;
+};
+
+// Shared by every shader using this fragment stage (FrameUniforms in RenderTypes.hpp)
+layout(std140, binding = 3) uniform FrameUniforms {
+    vec3 uFogColor;
+    float uFogStart;
+    float uFogEnd;
     float uSkyBrightness;
 };
 
@@ -36,9 +41,23 @@ float getBrightnessFromLight(float lightLevel) {
 }
 
 void main() {
+    // Merged faces carry UVs in block units; wrap them inside their 16x16 atlas
+    // tile. Gradients come from the unwrapped UVs so fract() doesn't drop the
+    // block seams to the smallest mip.
+    vec2 texCoord = vTexCoord;
+    vec2 texDx = dFdx(vTexCoord);
+    vec2 texDy = dFdy(vTexCoord);
+    if (vRepeat.y > 0.5) {
+        float tile = floor(vRepeat.x + 0.5);
+        vec2 tileOrigin = vec2(mod(tile, 16.0), floor(tile / 16.0));
+        texCoord = (tileOrigin + fract(vTexCoord) * (15.99 / 16.0)) / 16.0;
+        texDx /= 16.0;
+        texDy /= 16.0;
+    }
+
     vec4 color;
     if (uUseTexture != 0) {
-        vec4 texColor = texture(uTexture, vTexCoord);
+        vec4 texColor = textureGrad(uTexture, texCoord, texDx, texDy);
         color = texColor * vColor;
     } else {
         color = vColor;
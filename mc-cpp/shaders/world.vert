@@ -4,12 +4,14 @@ layout(location = 0) in vec3 aPosition;
 layout(location = 1) in vec2 aTexCoord;
 layout(location = 2) in vec4 aColor;
 layout(location = 3) in vec3 aNormal;
-layout(location = 4) in vec2 aLight;  // skyLight, blockLight (0-15 each)
+layout(location = 4) in vec4 aLight;  // skyLight, blockLight (0-15 each), atlas tile, repeat flag
 
 layout(binding = 0) uniform Uniforms {
     mat4 uMVP;
     mat4 uModelView;
     mat3 uNormalMatrix;
+    vec4 uColorScale;  // Multiplies the vertex color (cached sky and cloud meshes)
+    vec2 uTexOffset;   // Added to the texture coordinates (cloud scroll)
 };
 
 layout(location = 0) out vec2 vTexCoord;
@@ -18,14 +20,17 @@ layout(location = 2) out vec3 vNormal;
 layout(location = 3) out vec3 vViewNormal;
 layout(location = 4) out vec2 vLight;  // skyLight, blockLight (0-15)
 layout(location = 5) out float vFogDepth;
+layout(location = 6) out vec2 vRepeat;  // atlas tile, repeat flag (greedy merged faces)
 
 void main() {
     gl_Position = uMVP * vec4(aPosition, 1.0);
     vec4 viewPos = uModelView * vec4(aPosition, 1.0);
     vFogDepth = length(viewPos.xyz);
-    vTexCoord = aTexCoord;
-    vColor = aColor;
+    vTexCoord = aTexCoord + uTexOffset;
+    // Clamped after the scale, as the Tesselator clamped baked vertex colors
+    vColor = min(aColor * uColorScale, vec4(1.0));
     vNormal = aNormal;
     vViewNormal = normalize(uNormalMatrix * aNormal);
-    vLight = aLight;  // Pass light levels to fragment shader
+    vLight = aLight.xy;  // Pass light levels to fragment shader
+    vRepeat = aLight.zw;
 }
@@ -7,6 +7,7 @@
 #include "renderer/GameRenderer.hpp"
 #include "renderer/Tesselator.hpp"
 #include "renderer/Textures.hpp"
+#include "renderer/ItemIconAtlas.hpp"
 #include "renderer/ShaderManager.hpp"
 #include "audio/SoundEngine.hpp"
 #include "gui/Gui.hpp"
@@ -23,6 +24,7 @@
 #include <GLFW/glfw3.h>
 #include <iostream>
 #include <chrono>
+#include <algorithm>
 #include <cstdlib>
 
 namespace mc {
@@ -68,6 +70,10 @@ Minecraft::Minecraft()
     , framebufferWidth(854)
     , framebufferHeight(480)
     , fullscreen(false)
+    , offscreen(false)
+    , captureInterval(0)
+    , captureDirectory("captures")
+    , frameLimit(0)
     , running(false)
     , paused(false)
     , inGame(false)
@@ -112,9 +118,10 @@ bool Minecraft::init(int width, int height, bool fs) {
 
     // Create render context (handles backend-specific window configuration)
     auto renderContext = createRenderContext();
+    renderContext->setOffscreen(offscreen);
     renderContext->configureWindowHints();
 
-    GLFWmonitor* monitor = fullscreen ? glfwGetPrimaryMonitor() : nullptr;
+    GLFWmonitor* monitor = fullscreen && !offscreen ? glfwGetPrimaryMonitor() : nullptr;
     window = glfwCreateWindow(screenWidth, screenHeight, "Minecraft C++", monitor, nullptr);
 
     if (!window) {
@@ -156,6 +163,16 @@ bool Minecraft::init(int width, int height, bool fs) {
         return false;
     }
 
+    if (offscreen) {
+        if (!RenderDevice::get().setOffscreen(framebufferWidth, framebufferHeight)) {
+            std::cerr << "Offscreen rendering is not supported by this backend" << std::endl;
+            glfwDestroyWindow(window);
+            glfwTerminate();
+            return false;
+        }
+        RenderDevice::get().setFrameCapture(captureInterval, captureDirectory);
+    }
+
     // Apply vsync setting from options (handled by render context per-backend)
     RenderContext::get()->setVsync(options.vsync);
 
@@ -177,6 +194,9 @@ bool Minecraft::init(int width, int height, bool fs) {
     // Initialize tesselator
     Tesselator::getInstance().init();
 
+    // Pre-render GUI item icons (tiles, items, textures and shaders are ready)
+    ItemIconAtlas::getInstance().build();
+
     // Initialize audio
     SoundEngine::getInstance().init();
     SoundEngine::getInstance().setSoundVolume(options.sound);
@@ -275,12 +295,22 @@ void Minecraft::run() {
     auto& device = RenderDevice::get();
     auto* context = RenderContext::get();
 
+    // Offscreen runs report frame times when they end
+    std::vector<double> frameTimes;
+    int frames = 0;
+
     while (running && !glfwWindowShouldClose(window)) {
+        if (frameLimit > 0 && frames >= frameLimit) break;
+
         // Per-frame setup (Metal: create autorelease pool, OpenGL: no-op)
         context->beginFrame();
 
         auto currentTime = std::chrono::high_resolution_clock::now();
+        if (offscreen && frames > 0) {
+            frameTimes.push_back(std::chrono::duration<double, std::milli>(currentTime - lastTime).count());
+        }
         lastTime = currentTime;
+        frames++;
 
         // Poll events
         glfwPollEvents();
@@ -317,6 +347,28 @@ void Minecraft::run() {
         Vec3::resetPool();
         AABB::resetPool();
     }
+
+    if (offscreen) {
+        printFrameTimes(frameTimes);
+    }
+}
+
+void Minecraft::printFrameTimes(std::vector<double>& frameTimes) const {
+    if (frameTimes.empty()) return;
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    double total = 0.0;
+    for (double ms : frameTimes) {
+        total += ms;
+    }
+    auto percentile = [&frameTimes](double p) {
+        return frameTimes[static_cast<size_t>(p * (frameTimes.size() - 1))];
+    };
+
+    std::cout << "Frame times over " << frameTimes.size() << " frames: avg "
+              << total / frameTimes.size() << " ms, median " << percentile(0.5)
+              << " ms, p95 " << percentile(0.95) << " ms, p99 " << percentile(0.99)
+              << " ms, max " << frameTimes.back() << " ms" << std::endl;
 }
 
 void Minecraft::tick() {
@@ -711,6 +763,9 @@ void Minecraft::onResize(int width, int height) {
 
     // Update viewport
     RenderDevice::get().setViewport(0, 0, framebufferWidth, framebufferHeight);
+    if (offscreen) {
+        RenderDevice::get().setOffscreen(framebufferWidth, framebufferHeight);
+    }
 
     // Handle platform-specific resize (Metal: recreates drawable, OpenGL: no-op)
     if (RenderContext::get()) {
@@ -811,6 +866,7 @@ void Minecraft::shutdown() {
 
     // Shutdown systems
     SoundEngine::getInstance().destroy();
+    ItemIconAtlas::getInstance().destroy();
     Textures::getInstance().destroy();
     Tesselator::getInstance().destroy();
     Item::destroyItems();
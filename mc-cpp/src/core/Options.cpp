@@ -46,6 +46,8 @@ void Options::load(const std::string& path) {
         // Misc
         else if (key == "fov") fov = std::stof(value);
         else if (key == "guiScale") guiScale = std::stoi(value);
+        else if (key == "ao") smoothLighting = (value == "true");
+        else if (key == "distantTerrain") distantTerrain = (value == "true");
         else if (key == "lastServer") lastServer = value;
         else if (key == "skin") skin = value;
     }
@@ -71,6 +73,8 @@ void Options::save(const std::string& path) {
     // C++ additions
     file << "fov:" << fov << "\n";
     file << "guiScale:" << guiScale << "\n";
+    file << "ao:" << (smoothLighting ? "true" : "false") << "\n";
+    file << "distantTerrain:" << (distantTerrain ? "true" : "false") << "\n";
 }
 
 std::string Options::getKeyName(int keyCode) {
@@ -3,15 +3,14 @@
 #include "core/Options.hpp"
 #include "entity/LocalPlayer.hpp"
 #include "renderer/LevelRenderer.hpp"
+#include "renderer/ItemIconAtlas.hpp"
 #include "renderer/Textures.hpp"
 #include "renderer/TileRenderer.hpp"
 #include "renderer/Tesselator.hpp"
 #include "renderer/MatrixStack.hpp"
 #include "renderer/ShaderManager.hpp"
 #include "renderer/backend/RenderDevice.hpp"
-#include "world/tile/Tile.hpp"
 #include "item/Inventory.hpp"
-#include "item/Item.hpp"
 #include <sstream>
 #include <iomanip>
 
@@ -94,16 +93,15 @@ void Gui::render(float partialTick) {
 
         if (player->inventory) {
             TileRenderer tileRenderer;
+            std::vector<SlotItem> slots;
 
             for (int i = 0; i < 9; i++) {
-                const ItemStack& item = player->inventory->getItem(i);
-                if (item.isEmpty()) continue;
-
                 int slotX = scaledWidth / 2 - 91 + 3 + i * 20;
                 int slotY = scaledHeight - 19;
-
-                renderGuiItem(item, slotX, slotY, blitOffset, &font, tileRenderer);
+                slots.push_back({&player->inventory->getItem(i), slotX, slotY});
             }
+
+            renderGuiItems(slots, blitOffset, &font, tileRenderer);
         }
 
         device.setCullFace(true);
@@ -357,100 +355,48 @@ void Gui::renderChat() {
 }
 
 void Gui::renderGuiItem(const ItemStack& item, int x, int y, float z, Font* font, TileRenderer& tileRenderer) {
-    if (item.isEmpty()) return;
+    renderGuiItems({{&item, x, y}}, z, font, tileRenderer);
+}
 
+void Gui::renderGuiItems(const std::vector<SlotItem>& items, float z, Font* font, TileRenderer& tileRenderer) {
     auto& device = RenderDevice::get();
-    device.setDepthTest(true);
-    device.clear(false, true);
-
-    if (item.id > 0 && item.id < 256) {
-        Tile* tile = Tile::tiles[item.id].get();
-        if (tile) {
-            // Check if this tile can be rendered as a 3D block in GUI (matching Java ItemRenderer.renderGuiItem)
-            int renderShape = static_cast<int>(tile->renderShape);
-            if (TileRenderer::canRender(renderShape)) {
-                // Render as 3D isometric block
-                Textures::getInstance().bind("resources/terrain.png");
-
-                MatrixStack::modelview().push();
-                MatrixStack::modelview().translate(static_cast<float>(x - 2), static_cast<float>(y + 3), z);
-                MatrixStack::modelview().scale(10.0f, 10.0f, 10.0f);
-                MatrixStack::modelview().translate(1.0f, 0.5f, 8.0f);
-                MatrixStack::modelview().rotate(-210.0f, 1.0f, 0.0f, 0.0f);
-                MatrixStack::modelview().rotate(-45.0f, 0.0f, 1.0f, 0.0f);
-
-                ShaderManager::getInstance().useWorldShader();
-                ShaderManager::getInstance().updateMatrices();
-                // Disable fog for GUI blocks by pushing fog very far away
-                ShaderManager::getInstance().updateFog(10000.0f, 20000.0f, 1.0f, 1.0f, 1.0f);
-
-                // renderTileForGUIWithColors handles its own begin/end cycles per face
-                tileRenderer.renderTileForGUIWithColors(tile, item.getAuxValue());
-
-                MatrixStack::modelview().pop();
-            } else {
-                // Render as 2D sprite from terrain.png (for torches, crosses, etc.)
-                Textures::getInstance().bind("resources/terrain.png");
-
-                int icon = tile->textureIndex;
-                int sx = (icon % 16) * 16;
-                int sy = (icon / 16) * 16;
-
-                ShaderManager::getInstance().useGuiShader();
-                ShaderManager::getInstance().updateMatrices();
-                ShaderManager::getInstance().setUseTexture(true);
-
-                float u0 = static_cast<float>(sx) / 256.0f;
-                float u1 = static_cast<float>(sx + 16) / 256.0f;
-                float v0 = static_cast<float>(sy) / 256.0f;
-                float v1 = static_cast<float>(sy + 16) / 256.0f;
-
-                Tesselator& t = Tesselator::getInstance();
-                t.begin(DrawMode::Quads);
-                t.color(1.0f, 1.0f, 1.0f, 1.0f);
-                t.tex(u0, v1); t.vertex(static_cast<float>(x), static_cast<float>(y + 16), z);
-                t.tex(u1, v1); t.vertex(static_cast<float>(x + 16), static_cast<float>(y + 16), z);
-                t.tex(u1, v0); t.vertex(static_cast<float>(x + 16), static_cast<float>(y), z);
-                t.tex(u0, v0); t.vertex(static_cast<float>(x), static_cast<float>(y), z);
-                t.end();
-            }
+    const ItemIconAtlas& atlas = ItemIconAtlas::getInstance();
+
+    if (atlas.isReady()) {
+        // Pre-rendered icons: one textured quad per slot, one draw for all
+        Textures::getInstance().bind(atlas.getTexture());
+
+        ShaderManager::getInstance().useGuiShader();
+        ShaderManager::getInstance().updateMatrices();
+        ShaderManager::getInstance().setUseTexture(true);
+
+        Tesselator& t = Tesselator::getInstance();
+        t.begin(DrawMode::Quads);
+        t.color(1.0f, 1.0f, 1.0f, 1.0f);
+        for (const SlotItem& slot : items) {
+            if (slot.item->isEmpty()) continue;
+            atlas.addIcon(t, slot.item->id, slot.item->getAuxValue(),
+                          static_cast<float>(slot.x), static_cast<float>(slot.y), z);
         }
-    } else if (item.id >= 256) {
-        Item* itemDef = Item::byId(item.id);
-        if (itemDef) {
-            Textures::getInstance().bind("resources/gui/items.png");
-
-            int icon = itemDef->getIcon();
-            int sx = icon % 16 * 16;
-            int sy = icon / 16 * 16;
-
-            ShaderManager::getInstance().useGuiShader();
-            ShaderManager::getInstance().updateMatrices();
-            ShaderManager::getInstance().setUseTexture(true);
-
-            float u0 = static_cast<float>(sx) / 256.0f;
-            float u1 = static_cast<float>(sx + 16) / 256.0f;
-            float v0 = static_cast<float>(sy) / 256.0f;
-            float v1 = static_cast<float>(sy + 16) / 256.0f;
-
-            Tesselator& t = Tesselator::getInstance();
-            t.begin(DrawMode::Quads);
-            t.color(1.0f, 1.0f, 1.0f, 1.0f);
-            t.tex(u0, v1); t.vertex(static_cast<float>(x), static_cast<float>(y + 16), z);
-            t.tex(u1, v1); t.vertex(static_cast<float>(x + 16), static_cast<float>(y + 16), z);
-            t.tex(u1, v0); t.vertex(static_cast<float>(x + 16), static_cast<float>(y), z);
-            t.tex(u0, v0); t.vertex(static_cast<float>(x), static_cast<float>(y), z);
-            t.end();
+        t.end();
+    } else {
+        for (const SlotItem& slot : items) {
+            if (slot.item->isEmpty()) continue;
+            device.setDepthTest(true);
+            device.clear(false, true);
+            ItemIconAtlas::renderIcon(slot.item->id, slot.item->getAuxValue(),
+                                      static_cast<float>(slot.x), static_cast<float>(slot.y), z, tileRenderer);
         }
     }
 
     device.setDepthTest(false);
 
-    if (item.count > 1 && font) {
-        std::string countStr = std::to_string(item.count);
-        int textX = x + 17 - font->getWidth(countStr);
-        int textY = y + 9;
-        device.setDepthTest(false);
+    if (!font) return;
+    for (const SlotItem& slot : items) {
+        if (slot.item->isEmpty() || slot.item->count <= 1) continue;
+        std::string countStr = std::to_string(slot.item->count);
+        int textX = slot.x + 17 - font->getWidth(countStr);
+        int textY = slot.y + 9;
         font->drawShadow(countStr, textX, textY, 0xFFFFFF);
     }
 }
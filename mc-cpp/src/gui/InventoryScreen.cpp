@@ -100,10 +100,13 @@ void InventoryScreen::renderSlots() {
     int highlightX = 0, highlightY = 0;
     bool hasHighlight = false;
 
+    // Collected and drawn together so the icons batch into one draw
+    std::vector<Gui::SlotItem> items;
+
     for (int i = 0; i < 9; i++) {
         int x = guiLeft + 8 + i * SLOT_SIZE;
         int y = guiTop + 142;
-        renderSlot(i, x, y);
+        addSlot(items, i, x, y);
         if (hoveredSlot == i) {
             highlightX = x;
             highlightY = y;
@@ -116,7 +119,7 @@ void InventoryScreen::renderSlots() {
             int slot = 9 + row * 9 + col;
             int x = guiLeft + 8 + col * SLOT_SIZE;
             int y = guiTop + 84 + row * SLOT_SIZE;
-            renderSlot(slot, x, y);
+            addSlot(items, slot, x, y);
             if (hoveredSlot == slot) {
                 highlightX = x;
                 highlightY = y;
@@ -129,7 +132,7 @@ void InventoryScreen::renderSlots() {
         int slot = 36 + (3 - i);
         int x = guiLeft + 8;
         int y = guiTop + 8 + i * SLOT_SIZE;
-        renderSlot(slot, x, y);
+        addSlot(items, slot, x, y);
         if (hoveredSlot == slot) {
             highlightX = x;
             highlightY = y;
@@ -137,21 +140,18 @@ void InventoryScreen::renderSlots() {
         }
     }
 
+    TileRenderer tileRenderer;
+    Gui::renderGuiItems(items, 100.0f, font, tileRenderer);
+
     if (hasHighlight) {
         renderSlotHighlight(highlightX, highlightY);
     }
 }
 
-void InventoryScreen::renderSlot(int slotIndex, int x, int y) {
-    if (!minecraft->player || !minecraft->player->inventory) return;
-
-    Inventory* inv = minecraft->player->inventory.get();
-    const ItemStack& item = inv->getItem(slotIndex);
-
+void InventoryScreen::addSlot(std::vector<Gui::SlotItem>& items, int slotIndex, int x, int y) {
+    const ItemStack& item = minecraft->player->inventory->getItem(slotIndex);
     if (item.isEmpty()) return;
-
-    TileRenderer tileRenderer;
-    Gui::renderGuiItem(item, x, y, 100.0f, font, tileRenderer);
+    items.push_back({&item, x, y});
 }
 
 void InventoryScreen::renderDraggedItem() {
@@ -70,8 +70,13 @@ void OptionsScreen::initButtons() {
     buttons.push_back(std::make_unique<Button>(
         BUTTON_GRAPHICS, centerX + 5, startY + 96, 150, 20, getGraphicsLabel()));
 
+    buttons.push_back(std::make_unique<Button>(
+        BUTTON_SMOOTH_LIGHTING, centerX - 155, startY + 120, 150, 20, getSmoothLightingLabel()));
+    buttons.push_back(std::make_unique<Button>(
+        BUTTON_DISTANT_TERRAIN, centerX + 5, startY + 120, 150, 20, getDistantTerrainLabel()));
+
     auto controlsBtn = std::make_unique<Button>(
-        BUTTON_CONTROLS, centerX - 100, startY + 132, 200, 20, "Controls...");
+        BUTTON_CONTROLS, centerX - 100, startY + 144, 200, 20, "Controls...");
     controlsBtn->active = false;
     buttons.push_back(std::move(controlsBtn));
 
@@ -112,6 +117,12 @@ void OptionsScreen::updateButtonLabels() {
             case BUTTON_GRAPHICS:
                 btn->message = getGraphicsLabel();
                 break;
+            case BUTTON_SMOOTH_LIGHTING:
+                btn->message = getSmoothLightingLabel();
+                break;
+            case BUTTON_DISTANT_TERRAIN:
+                btn->message = getDistantTerrainLabel();
+                break;
         }
     }
 }
@@ -175,6 +186,14 @@ std::string OptionsScreen::getGraphicsLabel() const {
     return minecraft->options.fancyGraphics ? "Graphics: Fancy" : "Graphics: Fast";
 }
 
+std::string OptionsScreen::getSmoothLightingLabel() const {
+    return minecraft->options.smoothLighting ? "Smooth Lighting: ON" : "Smooth Lighting: OFF";
+}
+
+std::string OptionsScreen::getDistantTerrainLabel() const {
+    return minecraft->options.distantTerrain ? "Distant Terrain: ON" : "Distant Terrain: OFF";
+}
+
 void OptionsScreen::render(int mx, int my, float partialTick) {
     (void)partialTick;
     mouseX = mx;
@@ -367,6 +386,19 @@ void OptionsScreen::buttonClicked(int buttonId) {
             }
             updateButtonLabels();
             break;
+
+        case BUTTON_SMOOTH_LIGHTING:
+            minecraft->options.smoothLighting = !minecraft->options.smoothLighting;
+            if (minecraft->levelRenderer) {
+                minecraft->levelRenderer->allChanged();
+            }
+            updateButtonLabels();
+            break;
+
+        case BUTTON_DISTANT_TERRAIN:
+            minecraft->options.distantTerrain = !minecraft->options.distantTerrain;
+            updateButtonLabels();
+            break;
     }
 }
 
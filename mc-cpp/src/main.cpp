@@ -1,4 +1,6 @@
 #include "core/Minecraft.hpp"
+#include "world/LightingBenchmark.hpp"
+#include "renderer/RenderBenchmark.hpp"
 #include <iostream>
 #include <cstdlib>
 
@@ -12,6 +14,10 @@ int main(int argc, char* argv[]) {
     int width = 854;
     int height = 480;
     bool fullscreen = false;
+    bool offscreen = false;
+    int captureInterval = 0;
+    std::string captureDirectory = "captures";
+    int frameLimit = 0;
 
     for (int i = 1; i < argc; i++) {
         std::string arg = argv[i];
@@ -21,12 +27,40 @@ int main(int argc, char* argv[]) {
             width = std::atoi(argv[++i]);
         } else if (arg == "--height" && i + 1 < argc) {
             height = std::atoi(argv[++i]);
+        } else if (arg == "--offscreen") {
+            offscreen = true;
+        } else if (arg == "--capture" && i + 1 < argc) {
+            captureInterval = std::atoi(argv[++i]);
+        } else if (arg == "--capture-dir" && i + 1 < argc) {
+            captureDirectory = argv[++i];
+        } else if (arg == "--frames" && i + 1 < argc) {
+            frameLimit = std::atoi(argv[++i]);
+        } else if (arg == "--light-bench") {
+            // Run the lighting oracle/benchmark without opening a window
+            mc::LightingBenchmark::Config config;
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                config.edits = std::atoi(argv[++i]);
+            }
+            return mc::LightingBenchmark::run(config) ? 0 : 1;
+        } else if (arg == "--render-bench") {
+            // Render path on the null backend, no window or GPU needed
+            mc::RenderBenchmark::Config config;
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                config.frames = std::atoi(argv[++i]);
+            }
+            return mc::RenderBenchmark::run(config) ? 0 : 1;
         } else if (arg == "--help" || arg == "-h") {
             std::cout << "Usage: " << argv[0] << " [options]" << std::endl;
             std::cout << "Options:" << std::endl;
             std::cout << "  --width <n>     Set window width (default: 854)" << std::endl;
             std::cout << "  --height <n>    Set window height (default: 480)" << std::endl;
             std::cout << "  --fullscreen    Start in fullscreen mode" << std::endl;
+            std::cout << "  --offscreen     Render into an offscreen target with a hidden window" << std::endl;
+            std::cout << "  --capture <n>   With --offscreen, save every nth frame as PNG" << std::endl;
+            std::cout << "  --capture-dir <dir>  Directory for captured frames (default: captures)" << std::endl;
+            std::cout << "  --frames <n>    Quit after n frames" << std::endl;
+            std::cout << "  --light-bench [edits]  Check lighting against a full recompute and benchmark it" << std::endl;
+            std::cout << "  --render-bench [frames]  Benchmark the render path headless (null backend)" << std::endl;
             std::cout << "  --help          Show this help message" << std::endl;
             return 0;
         }
@@ -34,6 +68,10 @@ int main(int argc, char* argv[]) {
 
     // Create and run game
     mc::Minecraft game;
+    game.offscreen = offscreen;
+    game.captureInterval = captureInterval;
+    game.captureDirectory = captureDirectory;
+    game.frameLimit = frameLimit;
 
     if (!game.init(width, height, fullscreen)) {
         std::cerr << "Failed to initialize Minecraft" << std::endl;
@@ -1,21 +1,29 @@
 #include "particle/ParticleEngine.hpp"
-#include "particle/Particle.hpp"
-#include "particle/ExplodeParticle.hpp"
-#include "particle/FlameParticle.hpp"
-#include "particle/SmokeParticle.hpp"
 #include "entity/Entity.hpp"
 #include "world/Level.hpp"
+#include "phys/AABB.hpp"
 #include "renderer/Textures.hpp"
-#include "renderer/Tesselator.hpp"
 #include "renderer/ShaderManager.hpp"
 #include "renderer/backend/RenderDevice.hpp"
 #include "util/Mth.hpp"
+#include <algorithm>
 #include <cmath>
 
 namespace mc {
 
+// Billboard quad corners in quad index order, along (right, up)
+static constexpr float BILLBOARD_CORNERS[8] = {
+    -1.0f, -1.0f,
+    -1.0f,  1.0f,
+     1.0f,  1.0f,
+     1.0f, -1.0f
+};
+
+static_assert(ParticleVertexFormat::CORNER_STRIDE == 2 * sizeof(float));
+
 ParticleEngine::ParticleEngine()
     : level(nullptr)
+    , random(std::random_device{}())
 {
 }
 
@@ -28,12 +36,70 @@ void ParticleEngine::setLevel(Level* newLevel) {
     clear();
 }
 
-void ParticleEngine::add(std::unique_ptr<Particle> particle) {
-    if (!particle) return;
-    int texType = particle->getParticleTexture();
-    if (texType >= 0 && texType < TEXTURE_COUNT) {
-        particles[texType].push_back(std::move(particle));
+void ParticleEngine::add(Type type, double x, double y, double z, double xa, double ya, double za) {
+    // Base motion (Java Particle, started at rest): a random direction at a
+    // random speed, thrown slightly upward
+    double xd = (nextFloat() * 2.0f - 1.0f) * 0.4f;
+    double yd = (nextFloat() * 2.0f - 1.0f) * 0.4f;
+    double zd = (nextFloat() * 2.0f - 1.0f) * 0.4f;
+    float speed = (nextFloat() + nextFloat() + 1.0f) * 0.15f;
+    float dd = Mth::sqrt(static_cast<float>(xd * xd + yd * yd + zd * zd));
+    xd = xd / dd * speed * 0.4;
+    yd = yd / dd * speed * 0.4 + 0.1;
+    zd = zd / dd * speed * 0.4;
+    float size = (nextFloat() * 0.5f + 0.5f) * 2.0f;
+
+    float shade = 1.0f;
+    int lifetime = 0;
+    int tile = 0;
+    switch (type) {
+        case Type::Explode:
+            // Small jitter around the given velocity, larger and longer lived
+            xd = xa + (nextFloat() * 2.0f - 1.0f) * 0.05f;
+            yd = ya + (nextFloat() * 2.0f - 1.0f) * 0.05f;
+            zd = za + (nextFloat() * 2.0f - 1.0f) * 0.05f;
+            shade = nextFloat() * 0.3f + 0.7f;
+            size = nextFloat() * nextFloat() * 6.0f + 1.0f;
+            lifetime = static_cast<int>(16.0 / (nextFloat() * 0.8 + 0.2)) + 2;
+            tile = 0;
+            break;
+        case Type::Smoke:
+            xd = xd * 0.1 + xa;
+            yd = yd * 0.1 + ya;
+            zd = zd * 0.1 + za;
+            shade = nextFloat() * 0.3f;
+            size *= 0.75f;
+            lifetime = static_cast<int>(8.0 / (nextFloat() * 0.8 + 0.2));
+            tile = 7;
+            break;
+        case Type::Flame:
+            xd = xd * 0.01f + xa;
+            yd = yd * 0.01f + ya;
+            zd = zd * 0.01f + za;
+            shade = 1.0f;
+            lifetime = static_cast<int>(8.0 / (nextFloat() * 0.8 + 0.2)) + 4;
+            tile = 48;
+            break;
     }
+
+    types.push_back(type);
+    xs.push_back(x);
+    ys.push_back(y);
+    zs.push_back(z);
+    prevXs.push_back(x);
+    prevYs.push_back(y);
+    prevZs.push_back(z);
+    xds.push_back(xd);
+    yds.push_back(yd);
+    zds.push_back(zd);
+    sizes.push_back(size);
+    shades.push_back(shade);
+    brightness.push_back(1.0f);
+    ages.push_back(0);
+    lifetimes.push_back(lifetime);
+    tiles.push_back(static_cast<uint8_t>(tile));
+    onGround.push_back(0);
+    updateBrightness(types.size() - 1);
 }
 
 void ParticleEngine::addParticle(const std::string& name, double x, double y, double z,
@@ -41,119 +107,253 @@ void ParticleEngine::addParticle(const std::string& name, double x, double y, do
     if (!level) return;
 
     if (name == "explode") {
-        add(std::make_unique<ExplodeParticle>(level, x, y, z, xa, ya, za));
+        add(Type::Explode, x, y, z, xa, ya, za);
     } else if (name == "smoke") {
-        add(std::make_unique<SmokeParticle>(level, x, y, z, xa, ya, za));
+        add(Type::Smoke, x, y, z, xa, ya, za);
     } else if (name == "flame") {
-        add(std::make_unique<FlameParticle>(level, x, y, z, xa, ya, za));
+        add(Type::Flame, x, y, z, xa, ya, za);
     }
 }
 
 void ParticleEngine::tick() {
-    for (int tt = 0; tt < TEXTURE_COUNT; ++tt) {
-        for (auto it = particles[tt].begin(); it != particles[tt].end();) {
-            (*it)->tick();
-            if ((*it)->removed) {
-                it = particles[tt].erase(it);
-            } else {
-                ++it;
-            }
+    size_t i = 0;
+    while (i < types.size()) {
+        prevXs[i] = xs[i];
+        prevYs[i] = ys[i];
+        prevZs[i] = zs[i];
+
+        if (ages[i]++ >= lifetimes[i]) {
+            // The last particle moves into slot i and is ticked next
+            removeAt(i);
+            continue;
+        }
+
+        switch (types[i]) {
+            case Type::Explode:
+                // Cycle tiles 7 down to 0 over the lifetime, rise, drag
+                tiles[i] = static_cast<uint8_t>(std::max(0, 7 - ages[i] * 8 / lifetimes[i]));
+                yds[i] += 0.004;
+                move(i, xds[i], yds[i], zds[i]);
+                xds[i] *= 0.9;
+                yds[i] *= 0.9;
+                zds[i] *= 0.9;
+                break;
+            case Type::Smoke:
+                tiles[i] = static_cast<uint8_t>(std::max(0, 7 - ages[i] * 8 / lifetimes[i]));
+                yds[i] += 0.004;
+                move(i, xds[i], yds[i], zds[i]);
+                // Spread out when blocked from rising (Java: if y == yo)
+                if (ys[i] == prevYs[i]) {
+                    xds[i] *= 1.1;
+                    zds[i] *= 1.1;
+                }
+                xds[i] *= 0.96;
+                yds[i] *= 0.96;
+                zds[i] *= 0.96;
+                break;
+            case Type::Flame:
+                // No collision (noPhysics in Java)
+                xs[i] += xds[i];
+                ys[i] += yds[i];
+                zs[i] += zds[i];
+                xds[i] *= 0.96;
+                yds[i] *= 0.96;
+                zds[i] *= 0.96;
+                break;
         }
+
+        // Ground friction
+        if (onGround[i]) {
+            xds[i] *= 0.7;
+            zds[i] *= 0.7;
+        }
+
+        updateBrightness(i);
+        i++;
     }
 }
 
-void ParticleEngine::render(Entity* player, float partialTick) {
-    if (!player) return;
+void ParticleEngine::move(size_t i, double dx, double dy, double dz) {
+    if (!level) {
+        xs[i] += dx;
+        ys[i] += dy;
+        zs[i] += dz;
+        return;
+    }
 
-    // Calculate camera orientation vectors for billboarding
-    float yRotRad = player->yRot * Mth::DEG_TO_RAD;
-    float xRotRad = player->xRot * Mth::DEG_TO_RAD;
+    double originalDx = dx;
+    double originalDy = dy;
+    double originalDz = dz;
 
-    float xa = Mth::cos(yRotRad);
-    float za = Mth::sin(yRotRad);
-    float xa2 = -za * Mth::sin(xRotRad);
-    float za2 = xa * Mth::sin(xRotRad);
-    float ya = Mth::cos(xRotRad);
+    double w = BB_SIZE / 2.0;
+    AABB bb(xs[i] - w, ys[i], zs[i] - w, xs[i] + w, ys[i] + BB_SIZE, zs[i] + w);
 
-    // Enable blending for particles
-    RenderDevice::get().setBlend(true, BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
+    // Get collision boxes
+    auto boxes = level->getCollisionBoxes(nullptr, bb.expand(dx, dy, dz));
 
-    ShaderManager::getInstance().useWorldShader();
-    ShaderManager::getInstance().setAlphaTest(0.01f);
-    ShaderManager::getInstance().updateMatrices();  // Important: update shader matrices
+    // Adjust Y movement
+    for (const auto& box : boxes) {
+        dy = box.clipYCollide(bb, dy);
+    }
+    bb = bb.move(0.0, dy, 0.0);
 
-    Tesselator& t = Tesselator::getInstance();
+    // Adjust X movement
+    for (const auto& box : boxes) {
+        dx = box.clipXCollide(bb, dx);
+    }
+    bb = bb.move(dx, 0.0, 0.0);
 
-    // Render each texture group
-    for (int tt = 0; tt < TEXTURE_COUNT; ++tt) {
-        if (particles[tt].empty()) continue;
+    // Adjust Z movement
+    for (const auto& box : boxes) {
+        dz = box.clipZCollide(bb, dz);
+    }
+    bb = bb.move(0.0, 0.0, dz);
 
-        // Bind appropriate texture
-        if (tt == MISC_TEXTURE) {
-            Textures::getInstance().bind("resources/particles.png", 0, false);  // No mipmaps for particles
-        } else if (tt == TERRAIN_TEXTURE) {
-            Textures::getInstance().bind("resources/terrain.png");  // Terrain uses mipmaps
-        } else if (tt == ITEM_TEXTURE) {
-            Textures::getInstance().bind("resources/gui/items.png", 0, false);  // No mipmaps for items
-        }
+    // Update position from bounding box
+    xs[i] = (bb.x0 + bb.x1) / 2.0;
+    ys[i] = bb.y0;
+    zs[i] = (bb.z0 + bb.z1) / 2.0;
 
-        t.begin(DrawMode::Quads);
+    // Check for ground collision
+    onGround[i] = originalDy != dy && originalDy < 0.0;
 
-        for (const auto& particle : particles[tt]) {
-            // Calculate texture coordinates (16x16 grid)
-            float u0 = static_cast<float>(particle->tex % 16) / 16.0f;
-            float u1 = u0 + 0.0624375f;  // ~1/16 - small gap to avoid bleeding
-            float v0 = static_cast<float>(particle->tex / 16) / 16.0f;
-            float v1 = v0 + 0.0624375f;
+    // Stop velocity on collision
+    if (originalDx != dx) xds[i] = 0.0;
+    if (originalDy != dy) yds[i] = 0.0;
+    if (originalDz != dz) zds[i] = 0.0;
+}
 
-            // Particle size (uses virtual method for animated sizes)
-            float r = 0.1f * particle->getRenderSize(partialTick);
+void ParticleEngine::updateBrightness(size_t i) {
+    if (!level) {
+        brightness[i] = 1.0f;
+        return;
+    }
+    brightness[i] = level->getBrightness(
+        static_cast<int>(std::floor(xs[i])),
+        static_cast<int>(std::floor(ys[i])),
+        static_cast<int>(std::floor(zs[i]))
+    );
+}
 
-            // Interpolated position in WORLD space (shader handles camera transform)
-            float px = static_cast<float>(particle->prevX + (particle->x - particle->prevX) * partialTick);
-            float py = static_cast<float>(particle->prevY + (particle->y - particle->prevY) * partialTick);
-            float pz = static_cast<float>(particle->prevZ + (particle->z - particle->prevZ) * partialTick);
+float ParticleEngine::getRenderSize(size_t i, float partialTick) const {
+    float life = (static_cast<float>(ages[i]) + partialTick) / static_cast<float>(lifetimes[i]);
+    switch (types[i]) {
+        case Type::Smoke:
+            // Grows to full size over the first 1/32 of its life
+            return sizes[i] * std::clamp(life * 32.0f, 0.0f, 1.0f);
+        case Type::Flame:
+            // Shrinks to half size
+            return sizes[i] * (1.0f - life * life * 0.5f);
+        case Type::Explode:
+            break;
+    }
+    return sizes[i];
+}
 
-            // Get brightness
-            float br = particle->getBrightness();
+void ParticleEngine::removeAt(size_t i) {
+    auto swapRemove = [i](auto& values) {
+        values[i] = values.back();
+        values.pop_back();
+    };
+    swapRemove(types);
+    swapRemove(xs);
+    swapRemove(ys);
+    swapRemove(zs);
+    swapRemove(prevXs);
+    swapRemove(prevYs);
+    swapRemove(prevZs);
+    swapRemove(xds);
+    swapRemove(yds);
+    swapRemove(zds);
+    swapRemove(sizes);
+    swapRemove(shades);
+    swapRemove(brightness);
+    swapRemove(ages);
+    swapRemove(lifetimes);
+    swapRemove(tiles);
+    swapRemove(onGround);
+}
 
-            // Set color with brightness
-            t.color(particle->rCol * br, particle->gCol * br, particle->bCol * br, particle->alpha);
+void ParticleEngine::render(Entity* player, float partialTick) {
+    if (!player || types.empty()) return;
 
-            // Render billboard quad (4 vertices) in world space
-            // The billboard always faces the camera using the orientation vectors
-            t.tex(u1, v1);
-            t.vertex(px - xa * r - xa2 * r, py - ya * r, pz - za * r - za2 * r);
+    // Calculate camera orientation vectors for billboarding
+    float yRotRad = player->yRot * Mth::DEG_TO_RAD;
+    float xRotRad = player->xRot * Mth::DEG_TO_RAD;
 
-            t.tex(u1, v0);
-            t.vertex(px - xa * r + xa2 * r, py + ya * r, pz - za * r + za2 * r);
+    float xa = Mth::cos(yRotRad);
+    float za = Mth::sin(yRotRad);
+    float xa2 = -za * Mth::sin(xRotRad);
+    float za2 = xa * Mth::sin(xRotRad);
+    float ya = Mth::cos(xRotRad);
 
-            t.tex(u0, v0);
-            t.vertex(px + xa * r + xa2 * r, py + ya * r, pz + za * r + za2 * r);
+    // One instance per particle: interpolated world position, half size,
+    // lit color and tile
+    static_assert(sizeof(Instance) == ParticleVertexFormat::INSTANCE_STRIDE);
+    size_t count = types.size();
+    instances.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        Instance& instance = instances[i];
+        instance.x = static_cast<float>(prevXs[i] + (xs[i] - prevXs[i]) * partialTick);
+        instance.y = static_cast<float>(prevYs[i] + (ys[i] - prevYs[i]) * partialTick);
+        instance.z = static_cast<float>(prevZs[i] + (zs[i] - prevZs[i]) * partialTick);
+        instance.radius = 0.1f * getRenderSize(i, partialTick);
 
-            t.tex(u0, v1);
-            t.vertex(px + xa * r - xa2 * r, py - ya * r, pz + za * r - za2 * r);
-        }
+        uint32_t grey = static_cast<uint32_t>(std::clamp(static_cast<int>(shades[i] * brightness[i] * 255.0f), 0, 255));
+        instance.color = grey | (grey << 8) | (grey << 16) | (0xFFu << 24);
+        instance.tile = static_cast<float>(tiles[i]);
+    }
 
-        t.end();
+    auto& device = RenderDevice::get();
+    IndexBuffer* quadIndices = device.getQuadIndexBuffer(1);
+    if (!cornerBuffer) {
+        cornerBuffer = device.createVertexBuffer();
+        cornerBuffer->upload(BILLBOARD_CORNERS, sizeof(BILLBOARD_CORNERS), BufferUsage::Static);
+        instanceBuffer = device.createVertexBuffer();
     }
+    instanceBuffer->upload(instances.data(), count * sizeof(Instance), BufferUsage::Stream);
+
+    // Enable blending for particles
+    device.setBlend(true, BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
+    Textures::getInstance().bind("resources/particles.png", 0, false);  // No mipmaps for particles
+
+    ShaderManager::getInstance().useParticleShader();
+    ShaderManager::getInstance().setAlphaTest(0.01f);
+    ShaderManager::getInstance().setBillboardAxes(xa, 0.0f, za, xa2, ya, za2);
+
+    cornerBuffer->bind();
+    device.setupParticleVertexAttributes(instanceBuffer.get());
+    quadIndices->bind();
+    DrawIndexedCommand cmd{6, static_cast<uint32_t>(count), 0, 0, 0};
+    device.multiDrawIndexed(PrimitiveType::Triangles, &cmd, 1);
+    cornerBuffer->unbind();
 
     // Restore state
-    RenderDevice::get().setBlend(false);
+    device.setBlend(false);
 }
 
 int ParticleEngine::getParticleCount() const {
-    int count = 0;
-    for (int tt = 0; tt < TEXTURE_COUNT; ++tt) {
-        count += static_cast<int>(particles[tt].size());
-    }
-    return count;
+    return static_cast<int>(types.size());
 }
 
 void ParticleEngine::clear() {
-    for (int tt = 0; tt < TEXTURE_COUNT; ++tt) {
-        particles[tt].clear();
-    }
+    types.clear();
+    xs.clear();
+    ys.clear();
+    zs.clear();
+    prevXs.clear();
+    prevYs.clear();
+    prevZs.clear();
+    xds.clear();
+    yds.clear();
+    zds.clear();
+    sizes.clear();
+    shades.clear();
+    brightness.clear();
+    ages.clear();
+    lifetimes.clear();
+    tiles.clear();
+    onGround.clear();
 }
 
 } // namespace mc
@@ -1,25 +1,30 @@
 #include "renderer/Chunk.hpp"
+#include "renderer/ChunkSnapshot.hpp"
 #include "renderer/TileRenderer.hpp"
 #include "renderer/Tesselator.hpp"
 #include "renderer/backend/RenderDevice.hpp"
-#include "renderer/backend/VertexBuffer.hpp"
 #include "world/Level.hpp"
 #include "world/tile/Tile.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 namespace mc {
 
-Chunk::Chunk(Level* level, int x0, int y0, int z0)
+Chunk::Chunk(Level* level, ChunkBufferArena* arena, int x0, int y0, int z0)
     : x0(x0), y0(y0), z0(z0)
     , x1(x0 + SIZE), y1(y0 + SIZE), z1(z0 + SIZE)
     , dirty(true), loaded(false), visible(false)
     , solidVertexCount(0), cutoutVertexCount(0), waterVertexCount(0)
     , solidIndexCount(0), cutoutIndexCount(0), waterIndexCount(0)
     , distanceSq(0.0f)
+    , buildGeneration(0)
+    , uploadedGeneration(0)
+    , waterSortX(0.0), waterSortY(0.0), waterSortZ(0.0)
+    , waterSortPending(false)
+    , waterSorted(false)
     , level(level)
-    , solidVBO(nullptr), solidEBO(nullptr)
-    , cutoutVBO(nullptr), cutoutEBO(nullptr)
-    , waterVBO(nullptr), waterEBO(nullptr)
-    , vaoInitialized(false)
+    , arena(arena)
 {
     bb = AABB(x0, y0, z0, x1, y1, z1);
 }
@@ -29,13 +34,19 @@ Chunk::~Chunk() {
 }
 
 void Chunk::dispose() {
-    solidVBO.reset();
-    solidEBO.reset();
-    cutoutVBO.reset();
-    cutoutEBO.reset();
-    waterVBO.reset();
-    waterEBO.reset();
-    vaoInitialized = false;
+    if (arena) {
+        arena->free(solidRange);
+        arena->free(cutoutRange);
+        arena->free(waterRange);
+    }
+    lightRefs = ChunkLightRefs();
+    for (auto& vertices : passVertices) {
+        vertices = std::vector<uint32_t>();
+    }
+    pendingLight.clear();
+    waterCentroids = std::vector<float>();
+    waterSlots = std::vector<uint32_t>();
+    loaded = false;
 }
 
 void Chunk::setDirty() {
@@ -55,174 +66,564 @@ void Chunk::calculateDistance(double camX, double camY, double camZ) {
     distanceSq = static_cast<float>(dx * dx + dy * dy + dz * dz);
 }
 
-void Chunk::uploadData(VertexBuffer* vbo, IndexBuffer* ebo,
-                       const Tesselator::VertexData& data) {
-    if (!vbo || !ebo) return;
+void Chunk::uploadData(ChunkBufferArena::Allocation& range, const ChunkMeshPass& data) {
+    if (!arena) return;
+
+    arena->free(range);
+    range = arena->allocate(data.vertices.data(), static_cast<uint32_t>(data.vertexCount));
+}
 
-    vbo->upload(data.vertices.data(), data.vertices.size() * sizeof(int), BufferUsage::Static);
-    ebo->upload(data.indices.data(), data.indices.size(), BufferUsage::Static);
+const ChunkBufferArena::Allocation& Chunk::getPassRange(int pass) const {
+    if (pass == 0) return solidRange;
+    if (pass == 1) return cutoutRange;
+    return waterRange;
 }
 
 void Chunk::rebuild(TileRenderer& renderer) {
     if (!level) return;
 
-    // Create buffers if needed
-    if (!vaoInitialized) {
-        auto& device = RenderDevice::get();
-        solidVBO = device.createVertexBuffer();
-        solidEBO = device.createIndexBuffer();
-        cutoutVBO = device.createVertexBuffer();
-        cutoutEBO = device.createIndexBuffer();
-        waterVBO = device.createVertexBuffer();
-        waterEBO = device.createIndexBuffer();
-        vaoInitialized = true;
-    }
-
-    rebuildSolid(renderer);
-    rebuildCutout(renderer);
-    rebuildWater(renderer);
+    ChunkSnapshot snapshot;
+    captureSnapshot(snapshot);
+
+    ChunkMesh mesh;
+    buildMesh(renderer, snapshot, mesh);
+    uploadMesh(std::move(mesh));
+    uploadedGeneration = ++buildGeneration;
     dirty = false;
-    loaded = true;
 }
 
-void Chunk::rebuildSolid(TileRenderer& renderer) {
-    Tesselator& t = Tesselator::getInstance();
-    t.begin(DrawMode::Quads);
-
-    solidVertexCount = 0;
-
-    for (int x = x0; x < x1; x++) {
-        for (int y = y0; y < y1; y++) {
-            for (int z = z0; z < z1; z++) {
-                int tileId = level->getTile(x, y, z);
-                if (tileId <= 0) continue;
+void Chunk::captureSnapshot(ChunkSnapshot& snapshot) const {
+    if (!level) return;
 
-                Tile* tile = Tile::tiles[tileId].get();
-                if (!tile) continue;
+    // Sections the level knows are uniform air need no copy and no scan
+    if (level->isSectionEmpty(x0, y0, z0)) {
+        snapshot.captureEmpty();
+        return;
+    }
+    snapshot.capture(*level, x0, y0, z0, SIZE);
+}
 
-                // Skip water/lava for solid pass
-                if (tile->renderShape == TileShape::LIQUID) continue;
+void Chunk::computeVisibility(const ChunkSnapshot& snapshot, ChunkVisibility& out) const {
+    // Cells that hide what is behind them: anything drawn as an opaque cube
+    static constexpr int CELLS = SIZE * SIZE * SIZE;
+    std::vector<uint8_t> open(CELLS);
+    for (int y = 0; y < SIZE; y++) {
+        for (int z = 0; z < SIZE; z++) {
+            for (int x = 0; x < SIZE; x++) {
+                Tile* tile = snapshot.getTileAt(x0 + x, y0 + y, z0 + z);
+                open[(y * SIZE + z) * SIZE + x] = !tile || tile->transparent;
+            }
+        }
+    }
 
-                // Skip cutout tiles (torches, flowers, etc.) for solid pass
-                if (tile->renderLayer == TileLayer::CUTOUT) continue;
+    // Each connected region of open cells links every face it touches
+    out.mask = 0;
+    std::vector<int> stack;
+    for (int start = 0; start < CELLS; start++) {
+        if (!open[start]) continue;
+        open[start] = 0;
+        stack.push_back(start);
+
+        int faces = 0;
+        while (!stack.empty()) {
+            int cell = stack.back();
+            stack.pop_back();
+            int x = cell % SIZE;
+            int z = (cell / SIZE) % SIZE;
+            int y = cell / (SIZE * SIZE);
+
+            // Same neighbour order as the faces: down, up, north, south, west, east
+            const bool onFace[6] = {y == 0, y == SIZE - 1, z == 0, z == SIZE - 1, x == 0, x == SIZE - 1};
+            const int step[6] = {-SIZE * SIZE, SIZE * SIZE, -SIZE, SIZE, -1, 1};
+            for (int face = 0; face < 6; face++) {
+                if (onFace[face]) {
+                    faces |= 1 << face;
+                } else if (open[cell + step[face]]) {
+                    open[cell + step[face]] = 0;
+                    stack.push_back(cell + step[face]);
+                }
+            }
+        }
 
-                renderer.renderTile(tile, x, y, z);
+        for (int a = 0; a < 6; a++) {
+            if (!(faces & (1 << a))) continue;
+            for (int b = a + 1; b < 6; b++) {
+                if (faces & (1 << b)) out.connect(a, b);
             }
         }
+        if (out.mask == ChunkVisibility::ALL_CONNECTED) return;
     }
+}
+
+void Chunk::buildMesh(TileRenderer& renderer, const ChunkSnapshot& snapshot, ChunkMesh& mesh) const {
+    // Nothing to emit for an all-air chunk (leaves the passes empty)
+    if (snapshot.isEmpty()) return;
 
-    solidVertexCount = t.getVertexCount();
+    computeVisibility(snapshot, mesh.visibility);
 
-    // Get vertex data without drawing
-    Tesselator::VertexData data = t.getVertexData();
-    solidIndexCount = static_cast<int>(data.indices.size());
+    renderer.setSnapshot(&snapshot);
 
-    if (solidIndexCount > 0) {
-        uploadData(solidVBO.get(), solidEBO.get(), data);
+    // Sample corner light once for the whole chunk when smooth lighting is on
+    if (renderer.smoothLighting) {
+        renderer.buildLightCache(x0, y0, z0, SIZE);
     }
-}
 
-void Chunk::rebuildCutout(TileRenderer& renderer) {
-    Tesselator& t = Tesselator::getInstance();
+    // Single scan: every block is read and classified once and rendered into
+    // one shared stream; each pass's vertex runs are recorded along the way
+    struct Run {
+        Pass pass;
+        int first;
+        int count;
+    };
+    std::vector<Run> runs;
+
+    // Full cubes under flat lighting skip renderTile: their visible faces are
+    // keyed (tile + light) per face direction and merged into larger quads
+    // after the scan. Indexed [face][slice][v][u], see the merge loop for axes.
+    static constexpr int FACE_SLICE = SIZE * SIZE;
+    std::vector<uint32_t> faceKeys;
+    bool mergedAny = false;
+
+    // Face directions, for the cells flat-lit faces read their light from
+    static constexpr int dx[6] = {0, 0, 0, 0, -1, 1};
+    static constexpr int dy[6] = {-1, 1, 0, 0, 0, 0};
+    static constexpr int dz[6] = {0, 0, -1, 1, 0, 0};
+
+    Tesselator& t = renderer.getTesselator();
+    t.trackLightSources(true);
     t.begin(DrawMode::Quads);
 
-    cutoutVertexCount = 0;
-
     for (int x = x0; x < x1; x++) {
         for (int y = y0; y < y1; y++) {
             for (int z = z0; z < z1; z++) {
-                int tileId = level->getTile(x, y, z);
+                int tileId = snapshot.getTile(x, y, z);
                 if (tileId <= 0) continue;
 
                 Tile* tile = Tile::tiles[tileId].get();
                 if (!tile) continue;
 
-                // Only render cutout tiles (torches, flowers, etc.) in this pass
-                if (tile->renderLayer != TileLayer::CUTOUT) continue;
-
+                // Water/lava go in the water pass, cutout tiles (torches,
+                // flowers, etc.) in the cutout pass, everything else is solid
+                Pass pass = Pass::Solid;
+                if (tile->renderShape == TileShape::LIQUID) {
+                    pass = Pass::Water;
+                } else if (tile->renderLayer == TileLayer::CUTOUT) {
+                    pass = Pass::Cutout;
+                }
+
+                if (pass == Pass::Solid && renderer.canMergeFaces(tile)) {
+                    if (faceKeys.empty()) faceKeys.assign(6 * SIZE * FACE_SLICE, 0);
+                    int lx = x - x0, ly = y - y0, lz = z - z0;
+                    const int slice[6] = {ly, ly, lz, lz, lx, lx};
+                    const int cell[6] = {lz * SIZE + lx, lz * SIZE + lx,
+                                         ly * SIZE + lx, ly * SIZE + lx,
+                                         ly * SIZE + lz, ly * SIZE + lz};
+                    for (int face = 0; face < 6; face++) {
+                        uint32_t key = renderer.getCubeFaceKey(tile, x, y, z, face);
+                        faceKeys[(face * SIZE + slice[face]) * FACE_SLICE + cell[face]] = key;
+                        mergedAny |= key != 0;
+                    }
+                    continue;
+                }
+
+                int first = t.getVertexCount();
                 renderer.renderTile(tile, x, y, z);
+                int count = t.getVertexCount() - first;
+                if (count == 0) continue;
+
+                if (!runs.empty() && runs.back().pass == pass) {
+                    runs.back().count += count;
+                } else {
+                    runs.push_back({pass, first, count});
+                }
             }
         }
     }
 
-    cutoutVertexCount = t.getVertexCount();
+    // Greedy merge each face slice: grow a run along u, then extend it along v
+    // while every cell of the next row matches. u/v are x/z for down and up,
+    // x/y for north and south, z/y for west and east.
+    if (mergedAny) {
+        int first = t.getVertexCount();
+        for (int face = 0; face < 6; face++) {
+            for (int slice = 0; slice < SIZE; slice++) {
+                uint32_t* mask = &faceKeys[(face * SIZE + slice) * FACE_SLICE];
+                for (int v = 0; v < SIZE; v++) {
+                    for (int u = 0; u < SIZE; ) {
+                        uint32_t key = mask[v * SIZE + u];
+                        if (key == 0) {
+                            u++;
+                            continue;
+                        }
+
+                        int w = 1;
+                        while (u + w < SIZE && mask[v * SIZE + u + w] == key) w++;
+
+                        int h = 1;
+                        while (v + h < SIZE) {
+                            const uint32_t* row = &mask[(v + h) * SIZE + u];
+                            if (!std::all_of(row, row + w, [key](uint32_t k) { return k == key; })) break;
+                            h++;
+                        }
+
+                        for (int dv = 0; dv < h; dv++) {
+                            std::fill_n(&mask[(v + dv) * SIZE + u], w, 0u);
+                        }
+
+                        int x = x0, y = y0, z = z0;
+                        if (face < 2) {
+                            x += u; y += slice; z += v;
+                        } else if (face < 4) {
+                            x += u; y += v; z += slice;
+                        } else {
+                            x += slice; y += v; z += u;
+                        }
+                        // A light change under a merged quad splits it, so its
+                        // cells can't be patched (a single face can)
+                        if (w * h > 1) {
+                            for (int dv = 0; dv < h; dv++) {
+                                for (int du = 0; du < w; du++) {
+                                    int cx = x, cy = y, cz = z;
+                                    if (face < 2) {
+                                        cx += du; cz += dv;
+                                    } else if (face < 4) {
+                                        cx += du; cy += dv;
+                                    } else {
+                                        cz += du; cy += dv;
+                                    }
+                                    mesh.light.mergedCells.push_back(snapshot.getCellIndex(
+                                        cx + dx[face], cy + dy[face], cz + dz[face]));
+                                }
+                            }
+                        }
+
+                        Tile* tile = Tile::tiles[TileRenderer::getTileIdFromFaceKey(key)].get();
+                        renderer.renderMergedFace(tile, face, x, y, z, w, h);
+                        u += w;
+                    }
+                }
+            }
+        }
+
+        int count = t.getVertexCount() - first;
+        if (count > 0) runs.push_back({Pass::Solid, first, count});
+    }
+
+    Tesselator::VertexData all = t.getVertexData();
+    t.trackLightSources(false);
+    renderer.clearLightCache();
+    renderer.setSnapshot(nullptr);
+
+    // Split the shared stream into the three passes, keeping quad order, and
+    // pack it into the compact chunk vertex format on the way. Quads whose four
+    // vertices read one cell are recorded against it for light patching.
+    ChunkLightRefs& light = mesh.light;
+    light.patchable = all.lightSources.size() == static_cast<size_t>(all.vertexCount);
+    for (const Run& run : runs) {
+        ChunkMeshPass& out = run.pass == Pass::Solid ? mesh.solid
+                           : run.pass == Pass::Cutout ? mesh.cutout
+                           : mesh.water;
+        uint32_t firstQuad = static_cast<uint32_t>(out.vertexCount / 4);
+        const int* src = all.vertices.data() + static_cast<size_t>(run.first) * Tesselator::VERTEX_STRIDE;
+        packVertices(src, run.count, out);
+
+        if (run.pass == Pass::Water) {
+            for (int q = 0; q < run.count / 4; q++) {
+                float centre[3] = {0.0f, 0.0f, 0.0f};
+                for (int i = 0; i < 4; i++) {
+                    const int* v = src + static_cast<size_t>(q * 4 + i) * Tesselator::VERTEX_STRIDE;
+                    for (int axis = 0; axis < 3; axis++) {
+                        float p;
+                        std::memcpy(&p, &v[axis], sizeof(float));
+                        centre[axis] += p * 0.25f;
+                    }
+                }
+                mesh.waterCentroids.push_back(centre[0] - static_cast<float>(x0));
+                mesh.waterCentroids.push_back(centre[1] - static_cast<float>(y0));
+                mesh.waterCentroids.push_back(centre[2] - static_cast<float>(z0));
+            }
+        }
 
-    // Get vertex data without drawing
-    Tesselator::VertexData data = t.getVertexData();
-    cutoutIndexCount = static_cast<int>(data.indices.size());
+        const int* sources = all.lightSources.data() + run.first;
+        for (int q = 0; light.patchable && q < run.count / 4; q++) {
+            const int* quad = sources + q * 4;
+            if (quad[0] == Tesselator::LIGHT_SOURCE_UNKNOWN ||
+                quad[1] != quad[0] || quad[2] != quad[0] || quad[3] != quad[0]) {
+                light.patchable = false;
+                break;
+            }
+            light.quads.push_back({quad[0], (static_cast<uint32_t>(run.pass) << 30) | (firstQuad + q)});
+        }
+    }
 
-    if (cutoutIndexCount > 0) {
-        uploadData(cutoutVBO.get(), cutoutEBO.get(), data);
+    if (!light.patchable) {
+        light = ChunkLightRefs();
+        return;
     }
+    std::sort(light.quads.begin(), light.quads.end(),
+              [](const ChunkLightRefs::Ref& a, const ChunkLightRefs::Ref& b) { return a.cell < b.cell; });
+    std::sort(light.mergedCells.begin(), light.mergedCells.end());
+    light.mergedCells.erase(std::unique(light.mergedCells.begin(), light.mergedCells.end()),
+                            light.mergedCells.end());
 }
 
-void Chunk::rebuildWater(TileRenderer& renderer) {
-    Tesselator& t = Tesselator::getInstance();
-    t.begin(DrawMode::Quads);
+void Chunk::packVertices(const int* src, int count, ChunkMeshPass& out) const {
+    // Grass tint TileRenderer multiplies into grass tops (chunk.vert reapplies it)
+    static constexpr float GRASS_TINT_G = 0.741f;
+
+    auto packPosition = [](float p, int origin) {
+        float scaled = (p - static_cast<float>(origin) + ChunkVertexFormat::POSITION_BIAS) *
+                       ChunkVertexFormat::POSITION_SCALE;
+        return static_cast<uint32_t>(std::clamp(std::lround(scaled), 0L, 0x7FFFL));
+    };
+    auto packUV = [](float uv, float scale) {
+        return static_cast<uint32_t>(std::clamp(std::lround(uv * scale), 0L, 0xFFFFL));
+    };
+
+    out.vertices.reserve(out.vertices.size() + static_cast<size_t>(count) * 3);
+    for (int i = 0; i < count; i++) {
+        const int* v = src + static_cast<size_t>(i) * Tesselator::VERTEX_STRIDE;
+        float x, y, z, u, tv;
+        std::memcpy(&x, &v[0], sizeof(float));
+        std::memcpy(&y, &v[1], sizeof(float));
+        std::memcpy(&z, &v[2], sizeof(float));
+        std::memcpy(&u, &v[3], sizeof(float));
+        std::memcpy(&tv, &v[4], sizeof(float));
+
+        uint32_t color = static_cast<uint32_t>(v[5]);
+        uint32_t r = color & 255, g = (color >> 8) & 255, b = (color >> 16) & 255;
+        uint32_t light = static_cast<uint32_t>(v[7]);
+        bool repeat = (light >> 24) & 1;
+
+        // Colors are a grey shade, except grass tops which carry the tint
+        bool tinted = r != g || g != b;
+        uint32_t shade = tinted ? static_cast<uint32_t>(std::min(255L, std::lround(g / GRASS_TINT_G)))
+                                : g;
+
+        uint32_t pu, pv;
+        if (repeat) {
+            // Block-unit UVs; fold the atlas tile into the high bits
+            int tile = (light >> 16) & 255;
+            pu = packUV(static_cast<float>((tile & 15) * 32) + u, ChunkVertexFormat::REPEAT_UV_SCALE);
+            pv = packUV(static_cast<float>((tile >> 4) * 32) + tv, ChunkVertexFormat::REPEAT_UV_SCALE);
+        } else {
+            pu = packUV(u, ChunkVertexFormat::UV_SCALE);
+            pv = packUV(tv, ChunkVertexFormat::UV_SCALE);
+        }
 
-    waterVertexCount = 0;
+        out.vertices.push_back(packPosition(x, x0) | (packPosition(y, y0) << 15) |
+                               (static_cast<uint32_t>(repeat) << 30) |
+                               (static_cast<uint32_t>(tinted) << 31));
+        out.vertices.push_back(packPosition(z, z0) | (pu << 16));
+        out.vertices.push_back(pv | ((light & 15) << 16) | (((light >> 8) & 15) << 20) |
+                               (shade << 24));
+    }
+    out.vertexCount += count;
+}
 
-    for (int x = x0; x < x1; x++) {
-        for (int y = y0; y < y1; y++) {
-            for (int z = z0; z < z1; z++) {
-                int tileId = level->getTile(x, y, z);
-                if (tileId <= 0) continue;
+void Chunk::uploadMesh(ChunkMesh&& mesh) {
+    int maxVertices = std::max({mesh.solid.vertexCount, mesh.cutout.vertexCount,
+                                mesh.water.vertexCount});
 
-                Tile* tile = Tile::tiles[tileId].get();
-                if (!tile) continue;
+    // Every pass is a quad list drawn with the device's shared quad indices;
+    // grow them now rather than in the middle of drawing
+    if (maxVertices > 0) {
+        RenderDevice::get().getQuadIndexBuffer(static_cast<size_t>(maxVertices / 4));
+    }
 
-                // Only render water/lava in this pass
-                if (tile->renderShape != TileShape::LIQUID) continue;
+    // Old ranges are freed even when a pass is now empty
+    solidVertexCount = mesh.solid.vertexCount;
+    solidIndexCount = solidVertexCount / 4 * 6;
+    uploadData(solidRange, mesh.solid);
 
-                renderer.renderTile(tile, x, y, z);
-            }
-        }
+    cutoutVertexCount = mesh.cutout.vertexCount;
+    cutoutIndexCount = cutoutVertexCount / 4 * 6;
+    uploadData(cutoutRange, mesh.cutout);
+
+    waterVertexCount = mesh.water.vertexCount;
+    waterIndexCount = waterVertexCount / 4 * 6;
+    uploadData(waterRange, mesh.water);
+
+    visibility = mesh.visibility;
+
+    // Keep what light patches need; an empty mesh reads no light at all
+    pendingLight.clear();
+    lightRefs = std::move(mesh.light);
+    lightRefs.patchable |= maxVertices == 0;
+    if (lightRefs.patchable) {
+        passVertices[0] = std::move(mesh.solid.vertices);
+        passVertices[1] = std::move(mesh.cutout.vertices);
+    } else {
+        passVertices[0] = std::vector<uint32_t>();
+        passVertices[1] = std::vector<uint32_t>();
     }
 
-    waterVertexCount = t.getVertexCount();
+    // Water is kept either way: it is re-sorted as the camera moves
+    passVertices[2] = std::move(mesh.water.vertices);
+    waterCentroids = std::move(mesh.waterCentroids);
+    waterSlots.clear();
+    waterSortPending = false;
+    waterSorted = false;
+    loaded = true;
+}
+
+bool Chunk::lightChanged(int x, int y, int z) {
+    // Already waiting for a remesh
+    if (dirty) return false;
+
+    // A build in flight would land on top of a patch with older light
+    if (!loaded || !lightRefs.patchable || buildGeneration != uploadedGeneration) {
+        setDirty();
+        return false;
+    }
+
+    int cell = ChunkSnapshot::getCellIndex(x, y, z, x0, y0, z0, SIZE);
+    if (cell < 0) return false;
+
+    if (std::binary_search(lightRefs.mergedCells.begin(), lightRefs.mergedCells.end(), cell)) {
+        setDirty();
+        return false;
+    }
+
+    // Nothing to do if no vertex reads this cell
+    auto ref = std::lower_bound(lightRefs.quads.begin(), lightRefs.quads.end(), cell,
+                                [](const ChunkLightRefs::Ref& r, int c) { return r.cell < c; });
+    if (ref == lightRefs.quads.end() || ref->cell != cell) return false;
+
+    pendingLight.push_back({x, y, z});
+    return pendingLight.size() == 1;
+}
+
+void Chunk::applyLightPatches() {
+    std::vector<PendingLight> cells;
+    cells.swap(pendingLight);
 
-    // Get vertex data without drawing
-    Tesselator::VertexData data = t.getVertexData();
-    waterIndexCount = static_cast<int>(data.indices.size());
+    // A remesh queued since then takes care of it
+    if (cells.empty() || dirty || !loaded || !level || !arena ||
+        buildGeneration != uploadedGeneration) {
+        return;
+    }
 
-    if (waterIndexCount > 0) {
-        uploadData(waterVBO.get(), waterEBO.get(), data);
+    // Rewrite the light byte of every vertex reading a changed cell
+    constexpr uint32_t QUAD_MASK = (1u << 30) - 1;
+    std::vector<uint32_t> touched[3];
+    for (const PendingLight& pending : cells) {
+        int cell = ChunkSnapshot::getCellIndex(pending.x, pending.y, pending.z, x0, y0, z0, SIZE);
+        uint32_t sky = static_cast<uint32_t>(std::clamp(level->getSkyLight(pending.x, pending.y, pending.z), 0, 15));
+        uint32_t block = static_cast<uint32_t>(std::clamp(level->getBlockLight(pending.x, pending.y, pending.z), 0, 15));
+        uint32_t light = (sky << 16) | (block << 20);
+
+        auto ref = std::lower_bound(lightRefs.quads.begin(), lightRefs.quads.end(), cell,
+                                    [](const ChunkLightRefs::Ref& r, int c) { return r.cell < c; });
+        for (; ref != lightRefs.quads.end() && ref->cell == cell; ++ref) {
+            int pass = static_cast<int>(ref->quad >> 30);
+            uint32_t quad = ref->quad & QUAD_MASK;
+            if (pass == 2 && !waterSlots.empty()) {
+                quad = waterSlots[quad];  // Moved by a sort
+            }
+            uint32_t* vertex = &passVertices[pass][static_cast<size_t>(quad) * 4 * 3];
+            for (int i = 0; i < 4; i++) {
+                vertex[i * 3 + 2] = (vertex[i * 3 + 2] & ~0x00FF0000u) | light;
+            }
+            touched[pass].push_back(quad);
+        }
+    }
+
+    // Upload each run of consecutive rewritten quads
+    for (int pass = 0; pass < 3; pass++) {
+        std::vector<uint32_t>& quads = touched[pass];
+        std::sort(quads.begin(), quads.end());
+        quads.erase(std::unique(quads.begin(), quads.end()), quads.end());
+
+        for (size_t i = 0; i < quads.size(); ) {
+            size_t end = i + 1;
+            while (end < quads.size() && quads[end] == quads[end - 1] + 1) end++;
+
+            uint32_t firstVertex = quads[i] * 4;
+            uint32_t vertexCount = static_cast<uint32_t>(end - i) * 4;
+            arena->update(getPassRange(pass), firstVertex,
+                          &passVertices[pass][static_cast<size_t>(firstVertex) * 3], vertexCount);
+            i = end;
+        }
     }
 }
 
-void Chunk::render(int pass) {
-    if (!loaded) return;
+bool Chunk::needsWaterSort(double camX, double camY, double camZ) const {
+    // A single quad has nothing to be ordered against
+    if (!loaded || waterSortPending || waterCentroids.size() < 6) return false;
+    if (!waterSorted) return true;
+
+    double dx = camX - waterSortX;
+    double dy = camY - waterSortY;
+    double dz = camZ - waterSortZ;
+    return dx * dx + dy * dy + dz * dz > WATER_SORT_DISTANCE * WATER_SORT_DISTANCE;
+}
 
-    auto& device = RenderDevice::get();
+void Chunk::sortQuadsBackToFront(const std::vector<float>& centroids,
+                                 float camX, float camY, float camZ,
+                                 std::vector<uint32_t>& order) {
+    size_t quads = centroids.size() / 3;
+
+    // Squared distances are non-negative floats, whose bits order like
+    // unsigned integers; inverting them puts the farthest quad first
+    std::vector<uint32_t> keys(quads);
+    order.resize(quads);
+    for (size_t i = 0; i < quads; i++) {
+        float dx = centroids[i * 3] - camX;
+        float dy = centroids[i * 3 + 1] - camY;
+        float dz = centroids[i * 3 + 2] - camZ;
+        float distSq = dx * dx + dy * dy + dz * dz;
+        uint32_t bits;
+        std::memcpy(&bits, &distSq, sizeof(bits));
+        keys[i] = ~bits;
+        order[i] = static_cast<uint32_t>(i);
+    }
 
-    if (pass == 0) {
-        // Solid pass
-        if (solidIndexCount > 0 && solidVBO && solidEBO) {
-            solidVBO->bind();
-            solidEBO->bind();
-            device.setupVertexAttributes();
-            device.drawIndexed(PrimitiveType::Triangles, solidIndexCount);
-            solidVBO->unbind();
+    // LSD radix sort, one byte per pass (stable, so equal keys keep mesh order)
+    std::vector<uint32_t> sortedKeys(quads);
+    std::vector<uint32_t> sortedOrder(quads);
+    for (int shift = 0; shift < 32; shift += 8) {
+        uint32_t offsets[257] = {};
+        for (uint32_t key : keys) {
+            offsets[((key >> shift) & 255) + 1]++;
         }
-    } else if (pass == 1) {
-        // Cutout pass (alpha-tested: torches, flowers, etc.)
-        if (cutoutIndexCount > 0 && cutoutVBO && cutoutEBO) {
-            cutoutVBO->bind();
-            cutoutEBO->bind();
-            device.setupVertexAttributes();
-            device.drawIndexed(PrimitiveType::Triangles, cutoutIndexCount);
-            cutoutVBO->unbind();
+        for (int i = 0; i < 256; i++) {
+            offsets[i + 1] += offsets[i];
         }
-    } else {
-        // Water pass (pass == 2)
-        if (waterIndexCount > 0 && waterVBO && waterEBO) {
-            waterVBO->bind();
-            waterEBO->bind();
-            device.setupVertexAttributes();
-            device.drawIndexed(PrimitiveType::Triangles, waterIndexCount);
-            waterVBO->unbind();
+        for (size_t i = 0; i < quads; i++) {
+            uint32_t slot = offsets[(keys[i] >> shift) & 255]++;
+            sortedKeys[slot] = keys[i];
+            sortedOrder[slot] = order[i];
         }
+        keys.swap(sortedKeys);
+        order.swap(sortedOrder);
     }
 }
 
+void Chunk::applyWaterOrder(const std::vector<uint32_t>& order) {
+    size_t quads = waterCentroids.size() / 3;
+    if (!arena || order.size() != quads || passVertices[2].size() != quads * 12) return;
+
+    if (waterSlots.empty()) {
+        waterSlots.resize(quads);
+        for (size_t i = 0; i < quads; i++) {
+            waterSlots[i] = static_cast<uint32_t>(i);
+        }
+    }
+
+    // Gather each quad from where it sits now into its new place
+    std::vector<uint32_t> sorted(passVertices[2].size());
+    for (size_t slot = 0; slot < quads; slot++) {
+        const uint32_t* quad = &passVertices[2][static_cast<size_t>(waterSlots[order[slot]]) * 12];
+        std::copy(quad, quad + 12, &sorted[slot * 12]);
+    }
+    for (size_t slot = 0; slot < quads; slot++) {
+        waterSlots[order[slot]] = static_cast<uint32_t>(slot);
+    }
+    passVertices[2].swap(sorted);
+
+    arena->update(waterRange, 0, passVertices[2].data(), static_cast<uint32_t>(quads * 4));
+    waterSorted = true;
+}
+
 } // namespace mc
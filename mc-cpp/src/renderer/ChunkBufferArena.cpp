@@ -0,0 +1,104 @@
+#include "renderer/ChunkBufferArena.hpp"
+#include "renderer/backend/RenderDevice.hpp"
+#include "renderer/backend/VertexBuffer.hpp"
+#include <algorithm>
+
+namespace mc {
+
+ChunkBufferArena::ChunkBufferArena(uint32_t initialCapacity)
+    : initialCapacity(std::max(initialCapacity, 1u))
+    , capacity(0)
+    , used(0)
+{
+}
+
+ChunkBufferArena::~ChunkBufferArena() = default;
+
+ChunkBufferArena::Allocation ChunkBufferArena::allocate(const void* vertices, uint32_t vertexCount) {
+    Allocation allocation;
+    if (vertexCount == 0) return allocation;
+
+    auto findFit = [&]() {
+        return std::find_if(freeRanges.begin(), freeRanges.end(),
+            [vertexCount](const auto& range) { return range.second >= vertexCount; });
+    };
+
+    auto it = findFit();
+    if (it == freeRanges.end()) {
+        // The new tail alone is large enough, however fragmented the rest is
+        grow(capacity + vertexCount);
+        it = findFit();
+    }
+
+    allocation.first = it->first;
+    allocation.count = vertexCount;
+
+    uint32_t remaining = it->second - vertexCount;
+    freeRanges.erase(it);
+    if (remaining > 0) {
+        freeRanges.emplace(allocation.first + vertexCount, remaining);
+    }
+    used += vertexCount;
+
+    buffer->uploadRange(vertices, static_cast<size_t>(allocation.first) * ChunkVertexFormat::STRIDE,
+                        static_cast<size_t>(vertexCount) * ChunkVertexFormat::STRIDE);
+    return allocation;
+}
+
+void ChunkBufferArena::update(const Allocation& allocation, uint32_t firstVertex,
+                              const void* vertices, uint32_t vertexCount) {
+    if (vertexCount == 0 || firstVertex + vertexCount > allocation.count) return;
+
+    buffer->uploadRange(vertices,
+                        static_cast<size_t>(allocation.first + firstVertex) * ChunkVertexFormat::STRIDE,
+                        static_cast<size_t>(vertexCount) * ChunkVertexFormat::STRIDE);
+}
+
+void ChunkBufferArena::free(Allocation& allocation) {
+    if (allocation.empty()) return;
+
+    used -= allocation.count;
+    addFreeRange(allocation.first, allocation.count);
+    allocation = Allocation();
+}
+
+void ChunkBufferArena::addFreeRange(uint32_t first, uint32_t count) {
+    // Merge with the following range
+    auto next = freeRanges.find(first + count);
+    if (next != freeRanges.end()) {
+        count += next->second;
+        freeRanges.erase(next);
+    }
+
+    // Merge with the preceding range
+    auto it = freeRanges.lower_bound(first);
+    if (it != freeRanges.begin()) {
+        auto prev = std::prev(it);
+        if (prev->first + prev->second == first) {
+            prev->second += count;
+            return;
+        }
+    }
+    freeRanges.emplace(first, count);
+}
+
+void ChunkBufferArena::grow(uint32_t minCapacity) {
+    uint32_t newCapacity = std::max(capacity * 2, initialCapacity);
+    while (newCapacity < minCapacity) {
+        newCapacity *= 2;
+    }
+
+    auto newBuffer = RenderDevice::get().createVertexBuffer();
+    newBuffer->upload(nullptr, static_cast<size_t>(newCapacity) * ChunkVertexFormat::STRIDE,
+                      BufferUsage::Static);
+    if (buffer && capacity > 0) {
+        newBuffer->copyFrom(*buffer, static_cast<size_t>(capacity) * ChunkVertexFormat::STRIDE);
+    }
+    buffer = std::move(newBuffer);
+
+    // The new space is one free range, joined to a free range at the old end
+    addFreeRange(capacity, newCapacity - capacity);
+    capacity = newCapacity;
+}
+
+} // namespace mc
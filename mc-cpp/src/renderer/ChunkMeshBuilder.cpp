@@ -0,0 +1,254 @@
+#include "renderer/ChunkMeshBuilder.hpp"
+#include "renderer/ChunkSnapshot.hpp"
+#include "renderer/Tesselator.hpp"
+#include "renderer/TileRenderer.hpp"
+#include "world/Level.hpp"
+#include <algorithm>
+
+namespace mc {
+
+ChunkMeshBuilder::ChunkMeshBuilder(int threadCount)
+    : running(true)
+    , busyWorkers(0)
+{
+    if (threadCount <= 0) {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+    }
+
+    for (int i = 0; i < threadCount; i++) {
+        auto worker = std::make_unique<Worker>();
+        worker->tesselator = std::make_unique<Tesselator>(true);
+        worker->renderer = std::make_unique<TileRenderer>(*worker->tesselator);
+        workers.push_back(std::move(worker));
+    }
+
+    // Start threads only once every worker is fully constructed
+    for (auto& worker : workers) {
+        worker->thread = std::thread(&ChunkMeshBuilder::workerFunction, this, worker.get());
+    }
+}
+
+ChunkMeshBuilder::~ChunkMeshBuilder() {
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        running = false;
+        jobs.clear();
+        sortJobs.clear();
+        tasks.clear();
+    }
+    jobAvailable.notify_all();
+
+    for (auto& worker : workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+void ChunkMeshBuilder::workerFunction(Worker* worker) {
+    while (true) {
+        Job job;
+        SortJob sortJob;
+        Task task;
+        bool sorting = false;
+        bool tasking = false;
+        {
+            std::unique_lock<std::mutex> lock(jobMutex);
+            jobAvailable.wait(lock, [this] {
+                return !running || !jobs.empty() || !sortJobs.empty() || !tasks.empty();
+            });
+            if (!running) return;
+
+            // Sorts are small and the camera is already looking at them;
+            // other tasks wait until no chunk needs building
+            if (!sortJobs.empty()) {
+                sortJob = std::move(sortJobs.front());
+                sortJobs.pop_front();
+                sorting = true;
+            } else if (!jobs.empty()) {
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            } else {
+                task = std::move(tasks.front());
+                tasks.pop_front();
+                tasking = true;
+            }
+            busyWorkers++;
+        }
+
+        if (tasking) {
+            task.work(*worker->renderer);
+
+            std::lock_guard<std::mutex> lock(resultMutex);
+            finishedTasks.push_back(std::move(task.finish));
+        } else if (sorting) {
+            SortResult result;
+            result.chunk = sortJob.chunk;
+            result.generation = sortJob.generation;
+            Chunk::sortQuadsBackToFront(sortJob.centroids, sortJob.camX, sortJob.camY, sortJob.camZ,
+                                        result.order);
+
+            std::lock_guard<std::mutex> lock(resultMutex);
+            sortResults.push_back(std::move(result));
+        } else {
+            Result result;
+            result.chunk = job.chunk;
+            result.generation = job.generation;
+            worker->renderer->smoothLighting = job.smoothLighting;
+            job.chunk->buildMesh(*worker->renderer, *job.snapshot, result.mesh);
+
+            std::lock_guard<std::mutex> lock(resultMutex);
+            results.push_back(std::move(result));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(jobMutex);
+            busyWorkers--;
+        }
+        jobsDrained.notify_all();
+    }
+}
+
+void ChunkMeshBuilder::schedule(Chunk* chunk, bool smoothLighting) {
+    if (!chunk || !chunk->level) return;
+
+    // Uniform air: nothing to build, so skip the worker round trip entirely
+    if (chunk->level->isSectionEmpty(chunk->x0, chunk->y0, chunk->z0)) {
+        chunk->uploadMesh(ChunkMesh());
+        chunk->uploadedGeneration = ++chunk->buildGeneration;
+        chunk->dirty = false;
+        return;
+    }
+
+    Job job;
+    job.chunk = chunk;
+    job.generation = ++chunk->buildGeneration;
+    job.smoothLighting = smoothLighting;
+    job.snapshot = std::make_unique<ChunkSnapshot>();
+    chunk->captureSnapshot(*job.snapshot);
+    chunk->dirty = false;
+
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        jobs.push_back(std::move(job));
+    }
+    jobAvailable.notify_one();
+}
+
+int ChunkMeshBuilder::uploadFinished(int maxUploads) {
+    std::vector<Result> finished;
+    {
+        std::lock_guard<std::mutex> lock(resultMutex);
+        if (results.empty()) return 0;
+
+        // Take the oldest results up to the budget, leave the rest for next frame
+        size_t take = std::min(results.size(), static_cast<size_t>(std::max(0, maxUploads)));
+        finished.assign(std::make_move_iterator(results.begin()),
+                        std::make_move_iterator(results.begin() + take));
+        results.erase(results.begin(), results.begin() + take);
+    }
+
+    int uploaded = 0;
+    for (Result& result : finished) {
+        // A newer build of this chunk already landed; this one is stale
+        if (result.generation <= result.chunk->uploadedGeneration) continue;
+
+        result.chunk->uploadMesh(std::move(result.mesh));
+        result.chunk->uploadedGeneration = result.generation;
+        uploaded++;
+    }
+    return uploaded;
+}
+
+void ChunkMeshBuilder::scheduleSort(Chunk* chunk, double camX, double camY, double camZ) {
+    if (!chunk) return;
+
+    SortJob job;
+    job.chunk = chunk;
+    job.generation = chunk->uploadedGeneration;
+    job.camX = static_cast<float>(camX - chunk->x0);
+    job.camY = static_cast<float>(camY - chunk->y0);
+    job.camZ = static_cast<float>(camZ - chunk->z0);
+    job.centroids = chunk->getWaterCentroids();
+
+    chunk->waterSortPending = true;
+    chunk->waterSortX = camX;
+    chunk->waterSortY = camY;
+    chunk->waterSortZ = camZ;
+
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        sortJobs.push_back(std::move(job));
+    }
+    jobAvailable.notify_one();
+}
+
+int ChunkMeshBuilder::applyFinishedSorts() {
+    std::vector<SortResult> finished;
+    {
+        std::lock_guard<std::mutex> lock(resultMutex);
+        finished.swap(sortResults);
+    }
+
+    int applied = 0;
+    for (SortResult& result : finished) {
+        // The mesh was replaced meanwhile; the new one gets its own sort
+        if (result.generation != result.chunk->uploadedGeneration) continue;
+
+        result.chunk->applyWaterOrder(result.order);
+        result.chunk->waterSortPending = false;
+        applied++;
+    }
+    return applied;
+}
+
+void ChunkMeshBuilder::scheduleTask(std::function<void(TileRenderer&)> work,
+                                    std::function<void()> finish) {
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        tasks.push_back({std::move(work), std::move(finish)});
+    }
+    jobAvailable.notify_one();
+}
+
+int ChunkMeshBuilder::finishTasks() {
+    std::vector<std::function<void()>> finished;
+    {
+        std::lock_guard<std::mutex> lock(resultMutex);
+        finished.swap(finishedTasks);
+    }
+
+    for (auto& finish : finished) {
+        finish();
+    }
+    return static_cast<int>(finished.size());
+}
+
+void ChunkMeshBuilder::discardAll() {
+    {
+        std::unique_lock<std::mutex> lock(jobMutex);
+        jobs.clear();
+        sortJobs.clear();
+        tasks.clear();
+        jobsDrained.wait(lock, [this] { return busyWorkers == 0; });
+    }
+
+    std::lock_guard<std::mutex> lock(resultMutex);
+    results.clear();
+    sortResults.clear();
+    finishedTasks.clear();
+}
+
+void ChunkMeshBuilder::waitIdle() {
+    std::unique_lock<std::mutex> lock(jobMutex);
+    jobsDrained.wait(lock, [this] {
+        return jobs.empty() && sortJobs.empty() && tasks.empty() && busyWorkers == 0;
+    });
+}
+
+size_t ChunkMeshBuilder::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(jobMutex);
+    return jobs.size() + static_cast<size_t>(busyWorkers);
+}
+
+} // namespace mc
@@ -0,0 +1,101 @@
+#include "renderer/ChunkSnapshot.hpp"
+#include "world/Level.hpp"
+#include "world/tile/Tile.hpp"
+
+namespace mc {
+
+ChunkSnapshot::ChunkSnapshot()
+    : ox(0), oy(0), oz(0)
+    , dim(0)
+    , empty(true)
+{
+}
+
+void ChunkSnapshot::capture(const Level& level, int x0, int y0, int z0, int size) {
+    ox = x0 - BORDER;
+    oy = y0 - BORDER;
+    oz = z0 - BORDER;
+    dim = size + BORDER * 2;
+    empty = true;
+
+    size_t total = static_cast<size_t>(dim) * dim * dim;
+    blocks.resize(total);
+    data.resize(total);
+    skyLight.resize(total);
+    blockLight.resize(total);
+
+    // Go through Level's accessors so out-of-world cells read exactly as they
+    // would during a main-thread rebuild
+    for (int y = 0; y < dim; y++) {
+        for (int z = 0; z < dim; z++) {
+            for (int x = 0; x < dim; x++) {
+                int wx = ox + x, wy = oy + y, wz = oz + z;
+                size_t index = (static_cast<size_t>(y) * dim + z) * dim + x;
+                int tileId = level.getTile(wx, wy, wz);
+                blocks[index] = static_cast<uint8_t>(tileId);
+                data[index] = static_cast<uint8_t>(level.getData(wx, wy, wz));
+                skyLight[index] = static_cast<uint8_t>(level.getSkyLight(wx, wy, wz));
+                blockLight[index] = static_cast<uint8_t>(level.getBlockLight(wx, wy, wz));
+
+                bool inChunk = x >= BORDER && x < dim - BORDER &&
+                               y >= BORDER && y < dim - BORDER &&
+                               z >= BORDER && z < dim - BORDER;
+                if (inChunk && tileId != 0) {
+                    empty = false;
+                }
+            }
+        }
+    }
+}
+
+void ChunkSnapshot::captureEmpty() {
+    dim = 0;
+    empty = true;
+}
+
+bool ChunkSnapshot::contains(int x, int y, int z) const {
+    return x >= ox && x < ox + dim &&
+           y >= oy && y < oy + dim &&
+           z >= oz && z < oz + dim;
+}
+
+int ChunkSnapshot::getIndex(int x, int y, int z) const {
+    return ((y - oy) * dim + (z - oz)) * dim + (x - ox);
+}
+
+int ChunkSnapshot::getCellIndex(int x, int y, int z) const {
+    return contains(x, y, z) ? getIndex(x, y, z) : -1;
+}
+
+int ChunkSnapshot::getCellIndex(int x, int y, int z, int x0, int y0, int z0, int size) {
+    int cellDim = size + BORDER * 2;
+    int cx = x - (x0 - BORDER), cy = y - (y0 - BORDER), cz = z - (z0 - BORDER);
+    if (cx < 0 || cx >= cellDim || cy < 0 || cy >= cellDim || cz < 0 || cz >= cellDim) return -1;
+    return (cy * cellDim + cz) * cellDim + cx;
+}
+
+int ChunkSnapshot::getTile(int x, int y, int z) const {
+    if (!contains(x, y, z)) return 0;
+    return blocks[getIndex(x, y, z)];
+}
+
+Tile* ChunkSnapshot::getTileAt(int x, int y, int z) const {
+    return Tile::tiles[getTile(x, y, z)].get();
+}
+
+int ChunkSnapshot::getData(int x, int y, int z) const {
+    if (!contains(x, y, z)) return 0;
+    return data[getIndex(x, y, z)];
+}
+
+int ChunkSnapshot::getSkyLight(int x, int y, int z) const {
+    if (!contains(x, y, z)) return 15;
+    return skyLight[getIndex(x, y, z)];
+}
+
+int ChunkSnapshot::getBlockLight(int x, int y, int z) const {
+    if (!contains(x, y, z)) return 0;
+    return blockLight[getIndex(x, y, z)];
+}
+
+} // namespace mc
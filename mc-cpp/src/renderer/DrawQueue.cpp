@@ -0,0 +1,64 @@
+#include "renderer/DrawQueue.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace mc {
+
+void DrawQueue::add(int pass, ShaderManager::Program shader, TextureHandle texture, float depth, DrawFn draw) {
+    // A frame binds a handful of textures, so a linear search is enough
+    auto it = std::find(textures.begin(), textures.end(), texture);
+    uint64_t textureIndex = static_cast<uint64_t>(it - textures.begin());
+    if (it == textures.end()) {
+        textures.push_back(texture);
+    }
+
+    uint64_t key = (static_cast<uint64_t>(pass & 0xFF) << 56) |
+                   (static_cast<uint64_t>(shader) << 48) |
+                   ((textureIndex & 0xFFFF) << 32) |
+                   depthBits(depth);
+    entries.push_back({key, static_cast<uint32_t>(draws.size())});
+    draws.push_back(std::move(draw));
+}
+
+uint32_t DrawQueue::depthBits(float depth) {
+    // Flip the float's bits so they order as unsigned integers: all of them
+    // for negatives, just the sign for positives
+    uint32_t bits = std::bit_cast<uint32_t>(depth);
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+void DrawQueue::submit(const PassFn& beginPass) {
+    // Stable, so equal keys draw in the order they were added
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const Entry& a, const Entry& b) { return a.key < b.key; });
+
+    auto& shaders = ShaderManager::getInstance();
+    int pass = -1;
+    int shader = -1;
+    int texture = -1;
+    for (const Entry& entry : entries) {
+        int entryPass = static_cast<int>(entry.key >> 56);
+        int entryShader = static_cast<int>((entry.key >> 48) & 0xFF);
+        int entryTexture = static_cast<int>((entry.key >> 32) & 0xFFFF);
+
+        if (entryPass != pass) {
+            pass = entryPass;
+            if (beginPass) beginPass(pass);
+        }
+        if (entryShader != shader) {
+            shader = entryShader;
+            shaders.use(static_cast<ShaderManager::Program>(shader));
+        }
+        if (entryTexture != texture) {
+            texture = entryTexture;
+            Textures::getInstance().bind(textures[texture]);
+        }
+        draws[entry.index]();
+    }
+
+    entries.clear();
+    draws.clear();
+    textures.clear();
+}
+
+} // namespace mc
@@ -111,6 +111,28 @@ bool Frustum::isVisible(double x0, double y0, double z0, double x1, double y1, d
     return true;
 }
 
+Frustum::Containment Frustum::classify(const AABB& box) const {
+    Containment result = Containment::Inside;
+    for (int i = 0; i < 6; i++) {
+        // Corner furthest along the plane normal decides outside, the
+        // nearest one decides inside
+        bool px = planes[i][0] > 0, py = planes[i][1] > 0, pz = planes[i][2] > 0;
+        float farDist = planes[i][0] * static_cast<float>(px ? box.x1 : box.x0) +
+                    planes[i][1] * static_cast<float>(py ? box.y1 : box.y0) +
+                    planes[i][2] * static_cast<float>(pz ? box.z1 : box.z0) + planes[i][3];
+        if (farDist < 0) {
+            return Containment::Outside;
+        }
+        float nearDist = planes[i][0] * static_cast<float>(px ? box.x0 : box.x1) +
+                     planes[i][1] * static_cast<float>(py ? box.y0 : box.y1) +
+                     planes[i][2] * static_cast<float>(pz ? box.z0 : box.z1) + planes[i][3];
+        if (nearDist < 0) {
+            result = Containment::Intersects;
+        }
+    }
+    return result;
+}
+
 bool Frustum::containsPoint(double x, double y, double z) const {
     for (int i = 0; i < 6; i++) {
         float dist = planes[i][0] * static_cast<float>(x) +
@@ -21,6 +21,9 @@ std::string GLSLTranspiler::transpile450to330(const std::string& source) {
     // Step 4: Remove layout(binding = N) from samplers
     result = removeSamplerBindings(result);
 
+    // Step 5: Remove the binding from std140 blocks (bound after linking)
+    result = removeBlockBindings(result);
+
     return result;
 }
 
@@ -144,4 +147,11 @@ std::string GLSLTranspiler::removeSamplerBindings(const std::string& source) {
     return std::regex_replace(source, samplerBindingRegex, "$1");
 }
 
+std::string GLSLTranspiler::removeBlockBindings(const std::string& source) {
+    // Matches: layout(std140, binding = 3) uniform FrameUniforms {
+    // Result: layout(std140) uniform FrameUniforms {
+    std::regex blockBindingRegex(R"(layout\s*\(\s*std140\s*,\s*binding\s*=\s*\d+\s*\))");
+    return std::regex_replace(source, blockBindingRegex, "layout(std140)");
+}
+
 } // namespace mc
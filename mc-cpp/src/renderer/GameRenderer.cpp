@@ -66,6 +66,9 @@ void GameRenderer::setupCamera(float partialTick) {
     float fov = 70.0f;
     float nearPlane = 0.05f;
     float farPlane = 256.0f;
+    if (minecraft->options.distantTerrain) {
+        farPlane *= TerrainLod::DISTANCE_SCALE;
+    }
 
     setupProjection(fov, nearPlane, farPlane);
 
@@ -144,6 +147,12 @@ void GameRenderer::setupFog() {
     fogStart = 20.0f * distMultiplier;
     fogEnd = 80.0f * distMultiplier;
 
+    // Distant terrain pushes the fog out with it
+    if (minecraft->options.distantTerrain) {
+        fogStart *= TerrainLod::DISTANCE_SCALE;
+        fogEnd *= TerrainLod::DISTANCE_SCALE;
+    }
+
     // Update shader fog uniforms
     ShaderManager::getInstance().updateFog(fogStart, fogEnd, fogRed, fogGreen, fogBlue);
 }
@@ -236,6 +245,12 @@ void GameRenderer::renderWorld(float partialTick) {
     double camY = player->getInterpolatedY(partialTick) + player->eyeHeight;
     double camZ = player->getInterpolatedZ(partialTick);
 
+    // Apply light edits made since the last tick (e.g. block placed this frame)
+    // so the chunks they dirty are picked up and rebuilt with final light
+    if (minecraft->level) {
+        minecraft->level->flushLightUpdates();
+    }
+
     levelRenderer->updateVisibleChunks(camX, camY, camZ);
     levelRenderer->updateDirtyChunks();
 
@@ -264,10 +279,20 @@ void GameRenderer::renderWorld(float partialTick) {
 
     // Re-bind terrain texture after sky rendering
     Textures::getInstance().bind("resources/terrain.png");
-    ShaderManager::getInstance().useWorldShader();
+
+    // Distant terrain first, in the world shader's vertex format. No alpha
+    // test: leaves read as solid canopy from afar.
+    if (minecraft->options.distantTerrain) {
+        ShaderManager::getInstance().useWorldShader();
+        ShaderManager::getInstance().setAlphaTest(0.0f);
+        ShaderManager::getInstance().updateMatrices();
+        levelRenderer->renderDistantTerrain();
+    }
+
+    // Chunks use the packed-vertex shader
+    ShaderManager::getInstance().useChunkShader();
     ShaderManager::getInstance().setAlphaTest(0.5f);  // Reset alpha test (sky sets it to 0)
     ShaderManager::getInstance().updateMatrices();
-    ShaderManager::getInstance().setSkyBrightness(skyBrightness);  // Re-set after shader switch
 
     // Render opaque geometry (pass 0)
     levelRenderer->render(partialTick, 0);
@@ -290,8 +315,9 @@ void GameRenderer::renderWorld(float partialTick) {
     }
 
     // Render transparent geometry - water (pass 2)
+    // (the outline and breaking animation switch shaders, so select the chunk shader again)
+    ShaderManager::getInstance().useChunkShader();
     ShaderManager::getInstance().setAlphaTest(0.0f);
-    ShaderManager::getInstance().setSkyBrightness(skyBrightness);  // Ensure sky brightness is set
     device.setBlend(true, BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
     levelRenderer->render(partialTick, 2);
     device.setBlend(false);
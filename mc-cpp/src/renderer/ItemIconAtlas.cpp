@@ -0,0 +1,231 @@
+#include "renderer/ItemIconAtlas.hpp"
+#include "renderer/Tesselator.hpp"
+#include "renderer/TileRenderer.hpp"
+#include "renderer/MatrixStack.hpp"
+#include "renderer/ShaderManager.hpp"
+#include "renderer/backend/RenderDevice.hpp"
+#include "world/tile/Tile.hpp"
+#include "item/Item.hpp"
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <iostream>
+
+namespace mc {
+
+ItemIconAtlas& ItemIconAtlas::getInstance() {
+    static ItemIconAtlas instance;
+    return instance;
+}
+
+void ItemIconAtlas::collectSlots() {
+    slots.clear();
+    slotKeys.clear();
+    auto addSlot = [this](int key) {
+        slots[key] = static_cast<int>(slotKeys.size());
+        slotKeys.push_back(key);
+    };
+
+    for (int id = 1; id < 256; id++) {
+        Tile* tile = Tile::tiles[id].get();
+        if (!tile) continue;
+
+        if (!TileRenderer::canRender(static_cast<int>(tile->renderShape))) {
+            addSlot(slotKey(id, 0));
+            continue;
+        }
+
+        // Data values only get their own icon when they change a face texture;
+        // the rest share the first icon with the same faces
+        std::vector<std::pair<std::array<int, 6>, int>> seen;
+        for (int data = 0; data < 16; data++) {
+            std::array<int, 6> faces;
+            for (int face = 0; face < 6; face++) {
+                faces[face] = tile->getTexture(face, data);
+            }
+            auto it = std::find_if(seen.begin(), seen.end(),
+                                   [&](const auto& entry) { return entry.first == faces; });
+            if (it == seen.end()) {
+                addSlot(slotKey(id, data));
+                seen.push_back({faces, slots[slotKey(id, data)]});
+            } else if (data > 0) {
+                slots[slotKey(id, data)] = it->second;
+            }
+        }
+    }
+
+    // Item icons don't depend on data
+    for (int id = 256; id < Item::MAX_ITEMS; id++) {
+        if (Item::byId(id)) {
+            addSlot(slotKey(id, 0));
+        }
+    }
+
+    rows = (static_cast<int>(slotKeys.size()) + COLUMNS - 1) / COLUMNS;
+}
+
+void ItemIconAtlas::build() {
+    destroy();
+    collectSlots();
+    if (rows == 0) return;
+
+    auto& device = RenderDevice::get();
+    int width = COLUMNS * ICON_SIZE;
+    int height = rows * ICON_SIZE;
+
+    // Transparent pixels, so unused slots and icon backgrounds blend away
+    std::vector<uint8_t> clearPixels(static_cast<size_t>(width) * height * 4, 0);
+    texture = device.createTexture();
+    texture->setFilter(TextureFilter::Nearest, TextureFilter::Nearest);
+    texture->setWrap(TextureWrap::ClampToEdge, TextureWrap::ClampToEdge);
+    texture->upload(width, height, clearPixels.data(), false);
+
+    if (!device.beginRenderToTexture(texture.get())) {
+        std::cout << "Item icon atlas unavailable, GUI items draw directly" << std::endl;
+        destroy();
+        return;
+    }
+
+    device.setClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    device.setDepthWrite(true);
+    device.clear(true, true);
+
+    // Icons replace the cleared pixels, alpha included
+    device.setBlend(false);
+    device.setCullFace(false);
+    device.setDepthTest(true);
+    ShaderManager::getInstance().setSkyBrightness(1.0f);
+
+    // Same projection as a GUI slot, squeezed into each icon's viewport
+    MatrixStack::projection().push();
+    MatrixStack::projection().loadIdentity();
+    MatrixStack::projection().ortho(0.0f, 16.0f, 16.0f, 0.0f, 1000.0f, 3000.0f);
+    MatrixStack::modelview().push();
+    MatrixStack::modelview().loadIdentity();
+    MatrixStack::modelview().translate(0.0f, 0.0f, -2000.0f);
+
+    TileRenderer tileRenderer;
+    for (int slot = 0; slot < static_cast<int>(slotKeys.size()); slot++) {
+        int key = slotKeys[slot];
+        device.setViewport((slot % COLUMNS) * ICON_SIZE, (slot / COLUMNS) * ICON_SIZE, ICON_SIZE, ICON_SIZE);
+        renderIcon(key / 16, key % 16, 0.0f, 0.0f, 0.0f, tileRenderer);
+    }
+
+    MatrixStack::modelview().pop();
+    MatrixStack::projection().pop();
+    device.endRenderToTexture();
+
+    device.setBlend(true, BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
+    device.setCullFace(true);
+
+    std::cout << "Item icon atlas: " << slotKeys.size() << " icons, "
+              << width << "x" << height << std::endl;
+}
+
+void ItemIconAtlas::destroy() {
+    texture.reset();
+    slots.clear();
+    slotKeys.clear();
+    rows = 0;
+}
+
+int ItemIconAtlas::getSlot(int id, int data) const {
+    auto it = slots.find(slotKey(id, data));
+    if (it == slots.end()) {
+        it = slots.find(slotKey(id, 0));
+        if (it == slots.end()) return -1;
+    }
+    return it->second;
+}
+
+bool ItemIconAtlas::addIcon(Tesselator& t, int id, int data, float x, float y, float z) const {
+    if (!texture) return false;
+    int slot = getSlot(id, data);
+    if (slot < 0) return false;
+
+    float w = static_cast<float>(COLUMNS * ICON_SIZE);
+    float h = static_cast<float>(rows * ICON_SIZE);
+    float u0 = static_cast<float>((slot % COLUMNS) * ICON_SIZE) / w;
+    float u1 = static_cast<float>((slot % COLUMNS) * ICON_SIZE + ICON_SIZE) / w;
+    // Rendered rows run bottom-up, so the slot's top edge is its higher v
+    float vTop = static_cast<float>((slot / COLUMNS) * ICON_SIZE + ICON_SIZE) / h;
+    float vBottom = static_cast<float>((slot / COLUMNS) * ICON_SIZE) / h;
+
+    t.tex(u0, vBottom); t.vertex(x, y + 16.0f, z);
+    t.tex(u1, vBottom); t.vertex(x + 16.0f, y + 16.0f, z);
+    t.tex(u1, vTop); t.vertex(x + 16.0f, y, z);
+    t.tex(u0, vTop); t.vertex(x, y, z);
+    return true;
+}
+
+void ItemIconAtlas::renderIcon(int id, int data, float x, float y, float z, TileRenderer& tileRenderer) {
+    TextureHandle spriteTexture = nullptr;
+    int icon = 0;
+
+    if (id > 0 && id < 256) {
+        Tile* tile = Tile::tiles[id].get();
+        if (!tile) return;
+
+        // Check if this tile can be rendered as a 3D block in GUI (matching Java ItemRenderer.renderGuiItem)
+        int renderShape = static_cast<int>(tile->renderShape);
+        if (TileRenderer::canRender(renderShape)) {
+            // Render as 3D isometric block
+            Textures::getInstance().bind("resources/terrain.png");
+
+            MatrixStack::modelview().push();
+            MatrixStack::modelview().translate(x - 2.0f, y + 3.0f, z);
+            MatrixStack::modelview().scale(10.0f, 10.0f, 10.0f);
+            MatrixStack::modelview().translate(1.0f, 0.5f, 8.0f);
+            MatrixStack::modelview().rotate(-210.0f, 1.0f, 0.0f, 0.0f);
+            MatrixStack::modelview().rotate(-45.0f, 0.0f, 1.0f, 0.0f);
+
+            ShaderManager::getInstance().useWorldShader();
+            ShaderManager::getInstance().updateMatrices();
+            // Disable fog for GUI blocks by pushing fog very far away
+            ShaderManager::getInstance().updateFog(10000.0f, 20000.0f, 1.0f, 1.0f, 1.0f);
+
+            // renderTileForGUIWithColors handles its own begin/end cycles per face
+            tileRenderer.renderTileForGUIWithColors(tile, data);
+
+            MatrixStack::modelview().pop();
+            return;
+        }
+
+        // Render as 2D sprite from terrain.png (for torches, crosses, etc.)
+        spriteTexture = Textures::getInstance().getTerrainTexture();
+        icon = tile->textureIndex;
+    } else if (id >= 256) {
+        Item* itemDef = Item::byId(id);
+        if (!itemDef) return;
+
+        spriteTexture = Textures::getInstance().getItemsTexture();
+        icon = itemDef->getIcon();
+    } else {
+        return;
+    }
+
+    Textures::getInstance().bind(spriteTexture);
+
+    int sx = icon % 16 * 16;
+    int sy = icon / 16 * 16;
+
+    ShaderManager::getInstance().useGuiShader();
+    ShaderManager::getInstance().updateMatrices();
+    ShaderManager::getInstance().setUseTexture(true);
+
+    float u0 = static_cast<float>(sx) / 256.0f;
+    float u1 = static_cast<float>(sx + 16) / 256.0f;
+    float v0 = static_cast<float>(sy) / 256.0f;
+    float v1 = static_cast<float>(sy + 16) / 256.0f;
+
+    Tesselator& t = Tesselator::getInstance();
+    t.begin(DrawMode::Quads);
+    t.color(1.0f, 1.0f, 1.0f, 1.0f);
+    t.tex(u0, v1); t.vertex(x, y + 16.0f, z);
+    t.tex(u1, v1); t.vertex(x + 16.0f, y + 16.0f, z);
+    t.tex(u1, v0); t.vertex(x + 16.0f, y, z);
+    t.tex(u0, v0); t.vertex(x, y, z);
+    t.end();
+}
+
+} // namespace mc
@@ -1,10 +1,10 @@
 #include "renderer/LevelRenderer.hpp"
 #include "core/Minecraft.hpp"
+#include "renderer/ChunkSnapshot.hpp"
 #include "renderer/Tesselator.hpp"
 #include "renderer/Textures.hpp"
 #include "renderer/MatrixStack.hpp"
 #include "renderer/ShaderManager.hpp"
-#include "renderer/model/ChickenModel.hpp"
 #include "entity/Entity.hpp"
 #include "entity/ItemEntity.hpp"
 #include "entity/LocalPlayer.hpp"
@@ -19,6 +19,24 @@
 
 namespace mc {
 
+// Sky and void planes: a grid of SKY_CELL quads at +-16 around the camera
+static constexpr int SKY_CELL = 64;
+static constexpr int SKY_CELLS = 256 / SKY_CELL + 2;
+
+// Flat clouds: (2 * FAST_CLOUD_CELLS)^2 quads of FAST_CLOUD_CELL blocks
+static constexpr int FAST_CLOUD_CELL = 32;
+static constexpr int FAST_CLOUD_CELLS = 256 / FAST_CLOUD_CELL;
+
+// Fancy clouds: boxes of FANCY_CLOUD_CELL blocks within FANCY_CLOUD_DISTANCE
+static constexpr int FANCY_CLOUD_CELL = 8;
+static constexpr int FANCY_CLOUD_CELLS = 32;
+static constexpr float FANCY_CLOUD_DISTANCE = 256.0f;
+static constexpr float FANCY_CLOUD_TOP = 120.0f;
+static constexpr float FANCY_CLOUD_HEIGHT = 4.0f;
+
+static constexpr float CLOUD_Y = 120.0f;
+static constexpr float CLOUD_UV_SCALE = 1.0f / 2048.0f;
+
 LevelRenderer::LevelRenderer(Minecraft* minecraft, Level* level)
     : level(nullptr)
     , minecraft(minecraft)
@@ -29,12 +47,9 @@ LevelRenderer::LevelRenderer(Minecraft* minecraft, Level* level)
     , firstRebuild(true)
     , destroyProgress(0.0f)
     , destroyX(-1), destroyY(-1), destroyZ(-1)
-    , starVAO(0), starVBO(0), starEBO(0)
-    , skyVAO(0), skyVBO(0), skyEBO(0)
-    , darkVAO(0), darkVBO(0), darkEBO(0)
-    , starIndexCount(0), skyIndexCount(0), darkIndexCount(0)
-    , skyVAOsInitialized(false)
 {
+    chunkArena = std::make_unique<ChunkBufferArena>();
+    meshBuilder = std::make_unique<ChunkMeshBuilder>();
     setLevel(level);
 }
 
@@ -43,12 +58,7 @@ LevelRenderer::~LevelRenderer() {
         level->removeListener(this);
     }
     disposeChunks();
-    disposeSkyVAOs();
-}
-
-void LevelRenderer::disposeSkyVAOs() {
-    // Sky geometry is now rendered via Tesselator, no VAOs to dispose
-    skyVAOsInitialized = false;
+    disposeSkyBuffers();
 }
 
 void LevelRenderer::setLevel(Level* newLevel) {
@@ -82,6 +92,7 @@ void LevelRenderer::createChunks() {
             for (int z = 0; z < zChunks; z++) {
                 chunks.push_back(std::make_unique<Chunk>(
                     level,
+                    chunkArena.get(),
                     x * Chunk::SIZE,
                     y * Chunk::SIZE,
                     z * Chunk::SIZE
@@ -89,12 +100,44 @@ void LevelRenderer::createChunks() {
             }
         }
     }
+
+    terrainLod = std::make_unique<TerrainLod>(level);
 }
 
 void LevelRenderer::disposeChunks() {
+    // Workers may still hold pointers to these chunks
+    if (meshBuilder) {
+        meshBuilder->discardAll();
+    }
+    terrainLod.reset();
     chunks.clear();
     visibleChunks.clear();
     dirtyChunks.clear();
+    lightPatchChunks.clear();
+    chunksByDistance.clear();
+    chunkOrderValid = false;
+    chunkOrigins.reset();
+}
+
+uint32_t LevelRenderer::getChunkIndex(const Chunk* chunk) const {
+    int cx = chunk->x0 / Chunk::SIZE;
+    int cy = chunk->y0 / Chunk::SIZE;
+    int cz = chunk->z0 / Chunk::SIZE;
+    return static_cast<uint32_t>((cx * yChunks + cy) * zChunks + cz);
+}
+
+void LevelRenderer::uploadChunkOrigins() {
+    constexpr size_t floatsPerChunk = ChunkVertexFormat::DRAW_DATA_STRIDE / sizeof(float);
+    std::vector<float> origins(chunks.size() * floatsPerChunk, 0.0f);
+    for (const auto& chunk : chunks) {
+        float* origin = &origins[getChunkIndex(chunk.get()) * floatsPerChunk];
+        origin[0] = static_cast<float>(chunk->x0);
+        origin[1] = static_cast<float>(chunk->y0);
+        origin[2] = static_cast<float>(chunk->z0);
+    }
+
+    chunkOrigins = RenderDevice::get().createVertexBuffer();
+    chunkOrigins->upload(origins.data(), origins.size() * sizeof(float), BufferUsage::Static);
 }
 
 Chunk* LevelRenderer::getChunkAt(int x, int y, int z) {
@@ -112,26 +155,33 @@ Chunk* LevelRenderer::getChunkAt(int x, int y, int z) {
     return chunks[index].get();
 }
 
-void LevelRenderer::tileChanged(int x, int y, int z) {
-    // Mark affected chunks as dirty
-    int radius = 1;  // Blocks can affect adjacent chunks (lighting)
-
-    for (int dx = -radius; dx <= radius; dx++) {
-        for (int dy = -radius; dy <= radius; dy++) {
-            for (int dz = -radius; dz <= radius; dz++) {
-                Chunk* chunk = getChunkAt(x + dx * Chunk::SIZE, y + dy * Chunk::SIZE, z + dz * Chunk::SIZE);
-                if (chunk) {
-                    chunk->setDirty();
-                }
+template <typename Fn>
+void LevelRenderer::forChunksReading(int x, int y, int z, Fn&& fn) {
+    // A chunk mesh reads its own blocks plus the snapshot border (face
+    // culling, corner light, liquid heights), so a block only matters to the
+    // chunks whose bordered box holds it: its own chunk, plus the face, edge
+    // or corner neighbours when it lies on the chunk boundary.
+    constexpr int border = ChunkSnapshot::BORDER;
+    int cx0 = std::max(Mth::floor(static_cast<double>(x - border) / Chunk::SIZE), 0);
+    int cy0 = std::max(Mth::floor(static_cast<double>(y - border) / Chunk::SIZE), 0);
+    int cz0 = std::max(Mth::floor(static_cast<double>(z - border) / Chunk::SIZE), 0);
+    int cx1 = std::min(Mth::floor(static_cast<double>(x + border) / Chunk::SIZE), xChunks - 1);
+    int cy1 = std::min(Mth::floor(static_cast<double>(y + border) / Chunk::SIZE), yChunks - 1);
+    int cz1 = std::min(Mth::floor(static_cast<double>(z + border) / Chunk::SIZE), zChunks - 1);
+
+    for (int cx = cx0; cx <= cx1; cx++) {
+        for (int cy = cy0; cy <= cy1; cy++) {
+            for (int cz = cz0; cz <= cz1; cz++) {
+                fn(chunks[(cx * yChunks + cy) * zChunks + cz].get());
             }
         }
     }
+}
 
-    // Also mark the specific chunk
-    Chunk* chunk = getChunkAt(x, y, z);
-    if (chunk) {
-        chunk->setDirty();
-    }
+void LevelRenderer::tileChanged(int x, int y, int z) {
+    // Light spreading further arrives as lightChanged calls for the blocks it reaches
+    forChunksReading(x, y, z, [](Chunk* chunk) { chunk->setDirty(); });
+    if (terrainLod) terrainLod->tileChanged(x, z);
 }
 
 void LevelRenderer::allChanged() {
@@ -139,7 +189,11 @@ void LevelRenderer::allChanged() {
 }
 
 void LevelRenderer::lightChanged(int x, int y, int z) {
-    tileChanged(x, y, z);
+    // Light is read within the same border as blocks. Flat-lit meshes get the
+    // new light written into their vertices next frame; others remesh.
+    forChunksReading(x, y, z, [this, x, y, z](Chunk* chunk) {
+        if (chunk->lightChanged(x, y, z)) lightPatchChunks.push_back(chunk);
+    });
 }
 
 void LevelRenderer::addParticle(const std::string& name, double x, double y, double z,
@@ -170,67 +224,216 @@ void LevelRenderer::rebuildAllChunks() {
     for (auto& chunk : chunks) {
         chunk->setDirty();
     }
+    if (terrainLod) terrainLod->allChanged();
+}
+
+void LevelRenderer::rebuildChunkOrder(int camChunkX, int camChunkY, int camChunkZ, bool horizontal) {
+    orderChunkX = camChunkX;
+    orderChunkY = camChunkY;
+    orderChunkZ = camChunkZ;
+    orderRenderDistance = renderDistance;
+    orderHorizontal = horizontal;
+    chunkOrderValid = true;
+
+    chunksByDistance.clear();
+    chunkInRange.assign(chunks.size(), 0);
+    chunkVisitFrame.assign(chunks.size(), 0);
+    columnFrame.assign(static_cast<size_t>(xChunks) * zChunks, 0);
+    columnContainment.resize(columnFrame.size());
+
+    // A chunk within render distance of any point of the camera's chunk has
+    // its center within renderDistance + 1 chunks of that chunk's center, so
+    // the exact per-frame distance test only ever removes chunks from this set
+    int reach = renderDistance + 1;
+    std::vector<std::pair<int, Chunk*>> candidates;
+    for (int cx = std::max(camChunkX - reach, 0); cx <= std::min(camChunkX + reach, xChunks - 1); cx++) {
+        for (int cy = std::max(camChunkY - reach, 0); cy <= std::min(camChunkY + reach, yChunks - 1); cy++) {
+            for (int cz = std::max(camChunkZ - reach, 0); cz <= std::min(camChunkZ + reach, zChunks - 1); cz++) {
+                int dx = cx - camChunkX, dy = cy - camChunkY, dz = cz - camChunkZ;
+                int distSq = dx * dx + dy * dy + dz * dz;
+                int rangeSq = horizontal ? dx * dx + dz * dz : distSq;
+                if (rangeSq > reach * reach) continue;
+
+                uint32_t index = static_cast<uint32_t>((cx * yChunks + cy) * zChunks + cz);
+                chunkInRange[index] = 1;
+                candidates.emplace_back(distSq, chunks[index].get());
+            }
+        }
+    }
+
+    std::stable_sort(candidates.begin(), candidates.end(),
+        [](const auto& a, const auto& b) { return a.first < b.first; });
+    chunksByDistance.reserve(candidates.size());
+    for (const auto& candidate : candidates) {
+        chunksByDistance.push_back(candidate.second);
+    }
+}
+
+bool LevelRenderer::isChunkInFrustum(const Chunk* chunk, const Frustum& frustum) {
+    // Coarse test on the chunk's whole column first, cached for the frame
+    int cx = chunk->x0 / Chunk::SIZE;
+    int cz = chunk->z0 / Chunk::SIZE;
+    size_t column = static_cast<size_t>(cx) * zChunks + cz;
+    if (columnFrame[column] != visibilityFrame) {
+        columnFrame[column] = visibilityFrame;
+        columnContainment[column] = frustum.classify(AABB(
+            chunk->x0, 0, chunk->z0, chunk->x1, yChunks * Chunk::SIZE, chunk->z1));
+    }
+
+    switch (columnContainment[column]) {
+        case Frustum::Containment::Outside: return false;
+        case Frustum::Containment::Inside: return true;
+        case Frustum::Containment::Intersects: break;
+    }
+    return frustum.isVisible(chunk->bb);
 }
 
 void LevelRenderer::updateVisibleChunks(double camX, double camY, double camZ) {
+    for (Chunk* chunk : visibleChunks) {
+        chunk->visible = false;
+    }
     visibleChunks.clear();
     dirtyChunks.clear();
 
     Frustum& frustum = Frustum::getInstance();
     frustum.update();
 
-    for (auto& chunk : chunks) {
+    // The distance-ordered candidate list only changes when the camera
+    // enters another chunk
+    int camChunkX = Mth::floor(camX / Chunk::SIZE);
+    int camChunkY = Mth::floor(camY / Chunk::SIZE);
+    int camChunkZ = Mth::floor(camZ / Chunk::SIZE);
+
+    // Distant terrain skips columns by horizontal distance, so detail chunks
+    // must be culled by the same metric or a ring is left with neither
+    bool horizontal = terrainLod && minecraft && minecraft->options.distantTerrain;
+    if (!chunkOrderValid || renderDistance != orderRenderDistance || horizontal != orderHorizontal ||
+        camChunkX != orderChunkX || camChunkY != orderChunkY || camChunkZ != orderChunkZ) {
+        rebuildChunkOrder(camChunkX, camChunkY, camChunkZ, horizontal);
+    }
+    visibilityFrame++;
+
+    for (Chunk* chunk : chunksByDistance) {
         chunk->calculateDistance(camX, camY, camZ);
+    }
 
-        // Check render distance
-        float maxDist = static_cast<float>(renderDistance * Chunk::SIZE);
-        if (chunk->distanceSq > maxDist * maxDist) {
-            chunk->visible = false;
-            continue;
+    float maxDist = static_cast<float>(renderDistance * Chunk::SIZE);
+    double maxDistSq = static_cast<double>(maxDist) * maxDist;
+    auto inRange = [&](Chunk* chunk) {
+        if (!horizontal) return chunk->distanceSq <= maxDist * maxDist;
+        // Same test as TerrainLod::render on the chunk's column centre
+        double dx = (chunk->x0 + chunk->x1) / 2.0 - camX;
+        double dz = (chunk->z0 + chunk->z1) / 2.0 - camZ;
+        return dx * dx + dz * dz <= maxDistSq;
+    };
+    auto inView = [&](Chunk* chunk, uint32_t index) {
+        return chunkInRange[index] && inRange(chunk) && isChunkInFrustum(chunk, frustum);
+    };
+
+    bool cameraInside = level &&
+        camChunkX >= 0 && camChunkX < xChunks &&
+        camChunkY >= 0 && camChunkY < yChunks &&
+        camChunkZ >= 0 && camChunkZ < zChunks;
+
+    if (!cameraInside) {
+        // No chunk to start the walk from (e.g. flying above the world):
+        // frustum and distance only
+        for (Chunk* chunk : chunksByDistance) {
+            chunk->visible = inView(chunk, getChunkIndex(chunk));
         }
-
-        // Frustum culling
-        if (!frustum.isVisible(chunk->bb)) {
-            chunk->visible = false;
-            continue;
+    } else {
+        // Cave culling: walk outward from the camera's chunk, crossing into a
+        // neighbour only if the current chunk connects the face we came in by
+        // to the face we leave by, and never stepping back against a direction
+        // already taken. Chunks no such path reaches are hidden behind opaque
+        // blocks whatever the frustum says.
+        static const int stepX[6] = {0, 0, 0, 0, -1, 1};
+        static const int stepY[6] = {-1, 1, 0, 0, 0, 0};
+        static const int stepZ[6] = {0, 0, -1, 1, 0, 0};
+
+        visibilityQueue.clear();
+
+        uint32_t startIndex = static_cast<uint32_t>((camChunkX * yChunks + camChunkY) * zChunks + camChunkZ);
+        chunkVisitFrame[startIndex] = visibilityFrame;
+        visibilityQueue.push_back({chunks[startIndex].get(), -1, 0});
+
+        for (size_t head = 0; head < visibilityQueue.size(); head++) {
+            VisibilityStep step = visibilityQueue[head];
+            step.chunk->visible = true;
+
+            int cx = step.chunk->x0 / Chunk::SIZE;
+            int cy = step.chunk->y0 / Chunk::SIZE;
+            int cz = step.chunk->z0 / Chunk::SIZE;
+
+            for (int face = 0; face < 6; face++) {
+                if (step.directions & (1 << (face ^ 1))) continue;
+                if (step.entryFace >= 0 && !step.chunk->visibility.connects(step.entryFace, face)) continue;
+
+                int nx = cx + stepX[face];
+                int ny = cy + stepY[face];
+                int nz = cz + stepZ[face];
+                if (nx < 0 || nx >= xChunks || ny < 0 || ny >= yChunks || nz < 0 || nz >= zChunks) continue;
+
+                uint32_t index = static_cast<uint32_t>((nx * yChunks + ny) * zChunks + nz);
+                if (chunkVisitFrame[index] == visibilityFrame) continue;
+                chunkVisitFrame[index] = visibilityFrame;
+
+                Chunk* neighbor = chunks[index].get();
+                if (!inView(neighbor, index)) continue;
+
+                // Faces come in opposite pairs (down/up, ...), so face ^ 1 is
+                // the neighbour's face we enter by
+                visibilityQueue.push_back({neighbor, face ^ 1,
+                                           static_cast<uint8_t>(step.directions | (1 << face))});
+            }
         }
+    }
 
-        chunk->visible = true;
-        visibleChunks.push_back(chunk.get());
+    // Read the lists off the distance order instead of sorting them: visible
+    // chunks back-to-front for transparency, dirty ones nearest first
+    for (auto it = chunksByDistance.rbegin(); it != chunksByDistance.rend(); ++it) {
+        if ((*it)->visible) visibleChunks.push_back(*it);
+    }
+    for (Chunk* chunk : chunksByDistance) {
+        if (chunk->visible && chunk->dirty) dirtyChunks.push_back(chunk);
+    }
 
-        if (chunk->dirty) {
-            dirtyChunks.push_back(chunk.get());
+    // Keep the water quads inside each visible chunk back-to-front too
+    for (Chunk* chunk : visibleChunks) {
+        if (chunk->needsWaterSort(camX, camY, camZ)) {
+            meshBuilder->scheduleSort(chunk, camX, camY, camZ);
         }
     }
 
-    // Sort by distance
-    sortChunks();
-}
-
-void LevelRenderer::sortChunks() {
-    // Sort visible chunks back-to-front for transparency
-    std::sort(visibleChunks.begin(), visibleChunks.end(),
-        [](Chunk* a, Chunk* b) { return a->distanceSq > b->distanceSq; });
-
-    // Sort dirty chunks front-to-back (rebuild closest first)
-    std::sort(dirtyChunks.begin(), dirtyChunks.end(),
-        [](Chunk* a, Chunk* b) { return a->distanceSq < b->distanceSq; });
+    if (terrainLod && minecraft && minecraft->options.distantTerrain) {
+        terrainLod->update(*meshBuilder, camX, camZ, renderDistance);
+    }
 }
 
 void LevelRenderer::updateDirtyChunks() {
-    chunksUpdated = 0;
-
-    // Rebuild more chunks on initial load, fewer during gameplay
-    int maxUpdates = firstRebuild ? 256 : 8;
-
-    int toUpdate = std::min(static_cast<int>(dirtyChunks.size()), maxUpdates);
-    for (int i = 0; i < toUpdate; i++) {
-        Chunk* chunk = dirtyChunks[i];
-        chunk->rebuild(tileRenderer);
-        chunksUpdated++;
+    // Upload meshes the workers finished since last frame (more on initial load)
+    int maxUploads = firstRebuild ? 256 : 64;
+    chunksUpdated = meshBuilder->uploadFinished(maxUploads);
+    meshBuilder->applyFinishedSorts();
+    meshBuilder->finishTasks();
+
+    // Light-only changes are patched into the uploaded vertices in place
+    for (Chunk* chunk : lightPatchChunks) {
+        chunk->applyLightPatches();
+    }
+    lightPatchChunks.clear();
+
+    // Hand dirty chunks to the workers, nearest first. Keeping only a few jobs
+    // per thread in flight means snapshots are taken close to when they are
+    // built, and a burst of edits can't queue up the whole world.
+    bool smoothLighting = minecraft && minecraft->options.smoothLighting;
+    size_t maxPending = static_cast<size_t>(meshBuilder->getThreadCount()) * 4;
+    for (Chunk* chunk : dirtyChunks) {
+        if (meshBuilder->getPendingCount() >= maxPending) break;
+        meshBuilder->schedule(chunk, smoothLighting);
     }
 
-    if (firstRebuild && dirtyChunks.size() <= static_cast<size_t>(maxUpdates)) {
+    if (firstRebuild && dirtyChunks.empty() && meshBuilder->getPendingCount() == 0) {
         firstRebuild = false;
     }
 }
@@ -238,30 +441,124 @@ void LevelRenderer::updateDirtyChunks() {
 void LevelRenderer::render(float /*partialTick*/, int pass) {
     chunksRendered = 0;
 
-    // Render all visible chunks
+    // One command per visible chunk with geometry in this pass, kept in the
+    // back-to-front order of visibleChunks
+    chunkDrawCommands.clear();
     for (Chunk* chunk : visibleChunks) {
-        if (chunk->loaded) {
-            chunk->render(pass);
-            if (pass == 0) chunksRendered++;
-        }
+        if (!chunk->loaded) continue;
+        if (pass == 0) chunksRendered++;
+
+        const ChunkBufferArena::Allocation& range = chunk->getPassRange(pass);
+        if (range.empty()) continue;
+
+        DrawIndexedCommand command;
+        command.indexCount = range.count / 4 * 6;
+        command.instanceCount = 1;
+        command.firstIndex = 0;
+        command.baseVertex = static_cast<int32_t>(range.first);
+        command.baseInstance = getChunkIndex(chunk);
+        chunkDrawCommands.push_back(command);
     }
+
+    VertexBuffer* vertices = chunkArena->getBuffer();
+    if (chunkDrawCommands.empty() || !vertices) return;
+
+    auto& device = RenderDevice::get();
+
+    // Both of these may upload, so they come before any binding
+    if (!chunkOrigins) {
+        uploadChunkOrigins();
+    }
+    IndexBuffer* quadIndices = device.getQuadIndexBuffer(0);  // Sized by Chunk::uploadMesh
+
+    vertices->bind();
+    quadIndices->bind();
+    device.setupChunkVertexAttributes(chunkOrigins.get());
+    device.multiDrawIndexed(PrimitiveType::Triangles, chunkDrawCommands.data(), chunkDrawCommands.size());
+    vertices->unbind();
+}
+
+void LevelRenderer::renderDistantTerrain() {
+    if (!terrainLod || !minecraft || !minecraft->options.distantTerrain) return;
+    terrainLod->render(Frustum::getInstance());
+}
+
+void LevelRenderer::initSkyBuffers() {
+    if (skyPlanes.buffer) return;
+
+    buildSkyPlanes();
+    buildStars();
 }
 
-void LevelRenderer::initSkyVAOs() {
-    if (skyVAOsInitialized) return;
+void LevelRenderer::disposeSkyBuffers() {
+    skyPlanes = SkyMesh();
+    stars = SkyMesh();
+    fastClouds = SkyMesh();
+    fancyClouds = SkyMesh();
+}
 
-    // Generate star data for later rendering via Tesselator
-    buildStarData();
+void LevelRenderer::uploadSkyMesh(SkyMesh& mesh, Tesselator& t) {
+    Tesselator::VertexData data = t.getVertexData();
+    auto& device = RenderDevice::get();
+    if (!mesh.buffer) {
+        mesh.buffer = device.createVertexBuffer();
+    }
+    mesh.buffer->upload(data.vertices.data(), data.vertices.size() * sizeof(int), BufferUsage::Static);
+    mesh.quads = data.vertexCount / 4;
+}
 
-    skyVAOsInitialized = true;
+void LevelRenderer::drawSkyMesh(const SkyMesh& mesh, int firstQuad, int quadCount) {
+    if (!mesh.buffer || quadCount <= 0) return;
+
+    auto& device = RenderDevice::get();
+    IndexBuffer* quadIndices = device.getQuadIndexBuffer(quadCount);
+    mesh.buffer->bind();
+    device.setupVertexAttributes();
+    quadIndices->bind();
+    DrawIndexedCommand cmd{static_cast<uint32_t>(quadCount) * 6, 1, 0, firstQuad * 4, 0};
+    device.multiDrawIndexed(PrimitiveType::Triangles, &cmd, 1);
+    mesh.buffer->unbind();
 }
 
-void LevelRenderer::buildStarData() {
-    starVertices.clear();
+void LevelRenderer::buildSkyPlanes() {
+    // White, tinted per frame through the world shader's color scale
+    int s = SKY_CELL;
+    int d = SKY_CELLS;
+    Tesselator t(true);
+    t.begin(DrawMode::Quads);
+    t.color(1.0f, 1.0f, 1.0f, 1.0f);
+
+    float yy = 16.0f;
+    for (int xx = -s * d; xx <= s * d; xx += s) {
+        for (int zz = -s * d; zz <= s * d; zz += s) {
+            t.vertex(static_cast<float>(xx), yy, static_cast<float>(zz));
+            t.vertex(static_cast<float>(xx + s), yy, static_cast<float>(zz));
+            t.vertex(static_cast<float>(xx + s), yy, static_cast<float>(zz + s));
+            t.vertex(static_cast<float>(xx), yy, static_cast<float>(zz + s));
+        }
+    }
+
+    float yyDark = -16.0f;
+    for (int xx = -s * d; xx <= s * d; xx += s) {
+        for (int zz = -s * d; zz <= s * d; zz += s) {
+            // Reversed winding for bottom-facing plane
+            t.vertex(static_cast<float>(xx + s), yyDark, static_cast<float>(zz));
+            t.vertex(static_cast<float>(xx), yyDark, static_cast<float>(zz));
+            t.vertex(static_cast<float>(xx), yyDark, static_cast<float>(zz + s));
+            t.vertex(static_cast<float>(xx + s), yyDark, static_cast<float>(zz + s));
+        }
+    }
+
+    uploadSkyMesh(skyPlanes, t);
+}
 
+void LevelRenderer::buildStars() {
     // Generate deterministic stars matching Java (seed 10842)
     std::srand(10842);
 
+    Tesselator t(true);
+    t.begin(DrawMode::Quads);
+
     for (int i = 0; i < 1500; ++i) {
         float x = (static_cast<float>(std::rand()) / RAND_MAX) * 2.0f - 1.0f;
         float y = (static_cast<float>(std::rand()) / RAND_MAX) * 2.0f - 1.0f;
@@ -299,18 +596,18 @@ void LevelRenderer::buildStarData() {
                 float _xo = -_yo * xCos;
                 float xo = _xo * ySin - _zo * yCos;
                 float zo2 = _zo * ySin + _xo * yCos;
-                starVertices.push_back(xp + xo);
-                starVertices.push_back(yp + __yo);
-                starVertices.push_back(zp + zo2);
+                t.vertex(xp + xo, yp + __yo, zp + zo2);
             }
         }
     }
+
+    uploadSkyMesh(stars, t);
 }
 
 void LevelRenderer::renderSky(float partialTick) {
     if (!minecraft || !minecraft->player) return;
 
-    initSkyVAOs();
+    initSkyBuffers();
 
     LocalPlayer* player = minecraft->player;
     float camX = static_cast<float>(player->getInterpolatedX(partialTick));
@@ -341,23 +638,11 @@ void LevelRenderer::renderSky(float partialTick) {
     ShaderManager::getInstance().setUseTexture(false);  // No texture, just vertex color + fog
     ShaderManager::getInstance().setAlphaTest(0.0f);
 
-    // Render sky plane using Tesselator (provides proper vertex format for fog)
-    int s = 64;
-    int d = 256 / s + 2;
-    float yy = 16.0f;
-
-    Tesselator& t = Tesselator::getInstance();
-    t.begin(DrawMode::Quads);
-    t.color(skyR, skyG, skyB, 1.0f);
-    for (int xx = -s * d; xx <= s * d; xx += s) {
-        for (int zz = -s * d; zz <= s * d; zz += s) {
-            t.vertex(static_cast<float>(xx), yy, static_cast<float>(zz));
-            t.vertex(static_cast<float>(xx + s), yy, static_cast<float>(zz));
-            t.vertex(static_cast<float>(xx + s), yy, static_cast<float>(zz + s));
-            t.vertex(static_cast<float>(xx), yy, static_cast<float>(zz + s));
-        }
-    }
-    t.end();
+    // Sky plane is the first half of skyPlanes
+    int planeQuads = skyPlanes.quads / 2;
+    ShaderManager::getInstance().setColorScale(skyR, skyG, skyB, 1.0f);
+    drawSkyMesh(skyPlanes, 0, planeQuads);
+    ShaderManager::getInstance().setColorScale(1.0f, 1.0f, 1.0f, 1.0f);
 
     // Render sunrise/sunset glow
     device.setBlend(true, BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
@@ -402,6 +687,7 @@ void LevelRenderer::renderSky(float partialTick) {
     ShaderManager::getInstance().setUseTexture(true);
 
     // Render sun (Java size: 30.0f)
+    Tesselator& t = Tesselator::getInstance();
     float ss = 30.0f;
     if (Textures::getInstance().bindTexture("resources/terrain/sun.png")) {
         t.begin(DrawMode::Quads);
@@ -425,23 +711,12 @@ void LevelRenderer::renderSky(float partialTick) {
         t.end();
     }
 
-    // Render stars at night using Tesselator
+    // Render stars at night; their brightness is the sky shader's uniform color
     float starBrightness = getStarBrightness(timeOfDay);
-    if (starBrightness > 0.0f && !starVertices.empty()) {
+    if (starBrightness > 0.0f) {
         ShaderManager::getInstance().setUseTexture(false);
         ShaderManager::getInstance().setSkyColor(starBrightness, starBrightness, starBrightness, starBrightness);
-
-        // Render stars as quads via Tesselator
-        t.begin(DrawMode::Quads);
-        t.color(starBrightness, starBrightness, starBrightness, starBrightness);
-        for (size_t i = 0; i + 11 < starVertices.size(); i += 12) {
-            // 4 vertices per quad, 3 floats per vertex
-            t.vertex(starVertices[i], starVertices[i+1], starVertices[i+2]);
-            t.vertex(starVertices[i+3], starVertices[i+4], starVertices[i+5]);
-            t.vertex(starVertices[i+6], starVertices[i+7], starVertices[i+8]);
-            t.vertex(starVertices[i+9], starVertices[i+10], starVertices[i+11]);
-        }
-        t.end();
+        drawSkyMesh(stars, 0, stars.quads);
     }
 
     device.setBlend(false);
@@ -457,19 +732,9 @@ void LevelRenderer::renderSky(float partialTick) {
     ShaderManager::getInstance().setUseTexture(false);  // No texture, just vertex color + fog
     ShaderManager::getInstance().setAlphaTest(0.0f);
 
-    float yyDark = -16.0f;
-    t.begin(DrawMode::Quads);
-    t.color(voidR, voidG, voidB, 1.0f);
-    for (int xx = -s * d; xx <= s * d; xx += s) {
-        for (int zz = -s * d; zz <= s * d; zz += s) {
-            // Reversed winding for bottom-facing plane
-            t.vertex(static_cast<float>(xx + s), yyDark, static_cast<float>(zz));
-            t.vertex(static_cast<float>(xx), yyDark, static_cast<float>(zz));
-            t.vertex(static_cast<float>(xx), yyDark, static_cast<float>(zz + s));
-            t.vertex(static_cast<float>(xx + s), yyDark, static_cast<float>(zz + s));
-        }
-    }
-    t.end();
+    ShaderManager::getInstance().setColorScale(voidR, voidG, voidB, 1.0f);
+    drawSkyMesh(skyPlanes, planeQuads, planeQuads);
+    ShaderManager::getInstance().setColorScale(1.0f, 1.0f, 1.0f, 1.0f);
 
     MatrixStack::modelview().pop();  // Pop camera translation
 
@@ -550,16 +815,49 @@ void LevelRenderer::renderClouds(float partialTick) {
     }
 }
 
+void LevelRenderer::buildFastClouds() {
+    // Cells around the origin; renderFastClouds() moves them under the player
+    // and scrolls the texture
+    int s = FAST_CLOUD_CELL;
+    int d = FAST_CLOUD_CELLS;
+    Tesselator t(true);
+    t.begin(DrawMode::Quads);
+    t.color(1.0f, 1.0f, 1.0f, 0.8f);
+
+    for (int gx = -d; gx < d; gx++) {
+        for (int gz = -d; gz < d; gz++) {
+            float x0 = static_cast<float>(gx * s);
+            float x1 = static_cast<float>((gx + 1) * s);
+            float z0 = static_cast<float>(gz * s);
+            float z1 = static_cast<float>((gz + 1) * s);
+
+            float u0 = x0 * CLOUD_UV_SCALE;
+            float u1 = x1 * CLOUD_UV_SCALE;
+            float v0 = z0 * CLOUD_UV_SCALE;
+            float v1 = z1 * CLOUD_UV_SCALE;
+
+            t.tex(u0, v1); t.vertex(x0, CLOUD_Y, z1);
+            t.tex(u1, v1); t.vertex(x1, CLOUD_Y, z1);
+            t.tex(u1, v0); t.vertex(x1, CLOUD_Y, z0);
+            t.tex(u0, v0); t.vertex(x0, CLOUD_Y, z0);
+        }
+    }
+
+    uploadSkyMesh(fastClouds, t);
+}
+
 void LevelRenderer::renderFastClouds(float partialTick) {
     if (!minecraft || !minecraft->player) return;
+    if (!fastClouds.buffer) {
+        buildFastClouds();
+    }
 
     LocalPlayer* player = minecraft->player;
 
     double playerX = player->prevX + (player->x - player->prevX) * partialTick;
     double playerZ = player->prevZ + (player->z - player->prevZ) * partialTick;
 
-    int s = 32;
-    int d = 256 / s;
+    int s = FAST_CLOUD_CELL;
 
     auto& device = RenderDevice::get();
     device.setCullFace(false);
@@ -572,67 +870,135 @@ void LevelRenderer::renderFastClouds(float partialTick) {
     float cg = 0.9f * dayBrightness + 0.1f;
     float cb = 1.0f * dayBrightness + 0.1f;
 
-    float scale = 1.0f / 2048.0f;
     double cloudDrift = (minecraft->ticks + partialTick) * 0.03;
-    float cloudY = 120.0f;
 
     double centerX = std::floor(playerX / s) * s;
     double centerZ = std::floor(playerZ / s) * s;
 
     ShaderManager::getInstance().useWorldShader();
-    ShaderManager::getInstance().updateMatrices();
     ShaderManager::getInstance().setAlphaTest(0.0f);
 
-    Tesselator& t = Tesselator::getInstance();
-    t.begin(DrawMode::Quads);
-    t.color(cr, cg, cb, 0.8f);
+    // The texture repeats, so only the fraction of the offset matters
+    MatrixStack::modelview().push();
+    MatrixStack::modelview().translate(static_cast<float>(centerX), 0.0f, static_cast<float>(centerZ));
+    ShaderManager::getInstance().updateMatrices();
+    ShaderManager::getInstance().setColorScale(cr, cg, cb, 1.0f);
+    ShaderManager::getInstance().setTexOffset(
+        static_cast<float>(std::fmod((centerX + cloudDrift) * CLOUD_UV_SCALE, 1.0)),
+        static_cast<float>(std::fmod(centerZ * CLOUD_UV_SCALE, 1.0)));
 
-    for (int gx = -d; gx < d; gx++) {
-        for (int gz = -d; gz < d; gz++) {
-            float x0 = static_cast<float>(centerX + gx * s);
-            float x1 = static_cast<float>(centerX + (gx + 1) * s);
-            float z0 = static_cast<float>(centerZ + gz * s);
-            float z1 = static_cast<float>(centerZ + (gz + 1) * s);
-
-            float u0 = static_cast<float>(x0 + cloudDrift) * scale;
-            float u1 = static_cast<float>(x1 + cloudDrift) * scale;
-            float v0 = z0 * scale;
-            float v1 = z1 * scale;
-
-            t.tex(u0, v1); t.vertex(x0, cloudY, z1);
-            t.tex(u1, v1); t.vertex(x1, cloudY, z1);
-            t.tex(u1, v0); t.vertex(x1, cloudY, z0);
-            t.tex(u0, v0); t.vertex(x0, cloudY, z0);
-        }
-    }
+    drawSkyMesh(fastClouds, 0, fastClouds.quads);
 
-    t.end();
+    ShaderManager::getInstance().setColorScale(1.0f, 1.0f, 1.0f, 1.0f);
+    ShaderManager::getInstance().setTexOffset(0.0f, 0.0f);
+    MatrixStack::modelview().pop();
+    ShaderManager::getInstance().updateMatrices();
 
     device.setBlend(false);
     device.setCullFace(true, CullMode::Back);
 }
 
+void LevelRenderer::buildFancyClouds() {
+    // Cells around the origin, out to FANCY_CLOUD_DISTANCE from it rather than
+    // from the player, which is at most a cell off. Faces carry their shading
+    // in the vertex color; renderAdvancedClouds() tints, moves and scrolls them.
+    float cellSize = static_cast<float>(FANCY_CLOUD_CELL);
+    float y0 = FANCY_CLOUD_TOP - FANCY_CLOUD_HEIGHT;
+    float y1 = FANCY_CLOUD_TOP;
+    float alpha = 0.8f;
+
+    float topBright = 1.0f;
+    float bottomBright = 0.7f;
+    float sideBright = 0.9f;
+
+    Tesselator t(true);
+    t.begin(DrawMode::Quads);
+
+    for (int gx = -FANCY_CLOUD_CELLS; gx < FANCY_CLOUD_CELLS; ++gx) {
+        for (int gz = -FANCY_CLOUD_CELLS; gz < FANCY_CLOUD_CELLS; ++gz) {
+            float x0 = gx * cellSize;
+            float x1 = x0 + cellSize;
+            float z0 = gz * cellSize;
+            float z1 = z0 + cellSize;
+
+            float cellCenterX = x0 + cellSize * 0.5f;
+            float cellCenterZ = z0 + cellSize * 0.5f;
+            float dist = std::sqrt(cellCenterX * cellCenterX + cellCenterZ * cellCenterZ);
+            if (dist > FANCY_CLOUD_DISTANCE) continue;
+
+            float u0 = x0 * CLOUD_UV_SCALE;
+            float u1 = x1 * CLOUD_UV_SCALE;
+            float v0 = z0 * CLOUD_UV_SCALE;
+            float v1 = z1 * CLOUD_UV_SCALE;
+
+            float uCenter = (u0 + u1) * 0.5f;
+            float vCenter = (v0 + v1) * 0.5f;
+
+            // Top face
+            t.color(topBright, topBright, topBright, alpha);
+            t.tex(u0, v1); t.vertex(x0, y1, z1);
+            t.tex(u1, v1); t.vertex(x1, y1, z1);
+            t.tex(u1, v0); t.vertex(x1, y1, z0);
+            t.tex(u0, v0); t.vertex(x0, y1, z0);
+
+            // Bottom face
+            t.color(bottomBright, bottomBright, bottomBright, alpha);
+            t.tex(u0, v0); t.vertex(x0, y0, z0);
+            t.tex(u1, v0); t.vertex(x1, y0, z0);
+            t.tex(u1, v1); t.vertex(x1, y0, z1);
+            t.tex(u0, v1); t.vertex(x0, y0, z1);
+
+            // Side faces
+            t.color(sideBright, sideBright, sideBright, alpha);
+
+            // -X face
+            t.tex(uCenter, vCenter); t.vertex(x0, y0, z1);
+            t.tex(uCenter, vCenter); t.vertex(x0, y1, z1);
+            t.tex(uCenter, vCenter); t.vertex(x0, y1, z0);
+            t.tex(uCenter, vCenter); t.vertex(x0, y0, z0);
+
+            // +X face
+            t.tex(uCenter, vCenter); t.vertex(x1, y0, z0);
+            t.tex(uCenter, vCenter); t.vertex(x1, y1, z0);
+            t.tex(uCenter, vCenter); t.vertex(x1, y1, z1);
+            t.tex(uCenter, vCenter); t.vertex(x1, y0, z1);
+
+            // -Z face
+            t.tex(uCenter, vCenter); t.vertex(x0, y0, z0);
+            t.tex(uCenter, vCenter); t.vertex(x0, y1, z0);
+            t.tex(uCenter, vCenter); t.vertex(x1, y1, z0);
+            t.tex(uCenter, vCenter); t.vertex(x1, y0, z0);
+
+            // +Z face
+            t.tex(uCenter, vCenter); t.vertex(x1, y0, z1);
+            t.tex(uCenter, vCenter); t.vertex(x1, y1, z1);
+            t.tex(uCenter, vCenter); t.vertex(x0, y1, z1);
+            t.tex(uCenter, vCenter); t.vertex(x0, y0, z1);
+        }
+    }
+
+    uploadSkyMesh(fancyClouds, t);
+}
+
 void LevelRenderer::renderAdvancedClouds(float partialTick) {
     if (!minecraft || !minecraft->player) return;
+    if (!fancyClouds.buffer) {
+        buildFancyClouds();
+    }
 
     LocalPlayer* player = minecraft->player;
 
     double playerX = player->prevX + (player->x - player->prevX) * partialTick;
     double playerZ = player->prevZ + (player->z - player->prevZ) * partialTick;
 
-    int cellSize = 8;
-    int gridExtent = 32;
-    float cloudTop = 120.0f;
-    float cloudHeight = 4.0f;
-    float cloudY = cloudTop - cloudHeight;
-    float renderDist = 256.0f;
+    int cellSize = FANCY_CLOUD_CELL;
 
     double cloudDrift = (minecraft->ticks + partialTick) * 0.03;
-    float uvScale = 1.0f / 2048.0f;
 
     double centerX = std::floor(playerX / cellSize) * cellSize;
     double centerZ = std::floor(playerZ / cellSize) * cellSize;
     double driftOffset = std::fmod(cloudDrift, static_cast<double>(cellSize));
+    double originX = centerX - driftOffset;
 
     float timeOfDay = getTimeOfDay();
     float dayBrightness = std::cos(timeOfDay * 3.14159265f * 2.0f) * 0.5f + 0.5f;
@@ -649,9 +1015,8 @@ void LevelRenderer::renderAdvancedClouds(float partialTick) {
         cloudG += t * 0.1f;
     }
 
-    float topBright = 1.0f;
-    float bottomBright = 0.7f;
-    float sideBright = 0.9f;
+    // Left unclamped: the shader clamps after applying the per-face shade in
+    // the vertex colors, as the faces built per frame used to be
 
     // Bind cloud texture with NEAREST filtering (no mipmaps)
     Textures::getInstance().bind("resources/environment/clouds.png", 0, false);
@@ -660,7 +1025,14 @@ void LevelRenderer::renderAdvancedClouds(float partialTick) {
     device.setFrontFace(FrontFace::CounterClockwise);
 
     ShaderManager::getInstance().useWorldShader();
+
+    MatrixStack::modelview().push();
+    MatrixStack::modelview().translate(static_cast<float>(originX), 0.0f, static_cast<float>(centerZ));
     ShaderManager::getInstance().updateMatrices();
+    ShaderManager::getInstance().setColorScale(cloudR, cloudG, cloudB, 1.0f);
+    ShaderManager::getInstance().setTexOffset(
+        static_cast<float>(std::fmod((originX + cloudDrift) * CLOUD_UV_SCALE, 1.0)),
+        static_cast<float>(std::fmod(centerZ * CLOUD_UV_SCALE, 1.0)));
 
     // Two-pass rendering for proper transparency
     for (int pass = 0; pass < 2; ++pass) {
@@ -677,81 +1049,14 @@ void LevelRenderer::renderAdvancedClouds(float partialTick) {
             ShaderManager::getInstance().setAlphaTest(0.5f);
         }
 
-        Tesselator& t = Tesselator::getInstance();
-        t.begin(DrawMode::Quads);
-
-        for (int gx = -gridExtent; gx < gridExtent; ++gx) {
-            for (int gz = -gridExtent; gz < gridExtent; ++gz) {
-                float x0 = static_cast<float>(centerX + gx * cellSize - driftOffset);
-                float x1 = x0 + cellSize;
-                float z0 = static_cast<float>(centerZ + gz * cellSize);
-                float z1 = z0 + cellSize;
-
-                float cellCenterX = x0 + cellSize * 0.5f;
-                float cellCenterZ = z0 + cellSize * 0.5f;
-                float dx = cellCenterX - static_cast<float>(playerX);
-                float dz = cellCenterZ - static_cast<float>(playerZ);
-                float dist = std::sqrt(dx * dx + dz * dz);
-                if (dist > renderDist) continue;
-
-                float alpha = 0.8f;
-                float y0 = cloudY;
-                float y1 = cloudTop;
-
-                float u0 = static_cast<float>(x0 + cloudDrift) * uvScale;
-                float u1 = static_cast<float>(x1 + cloudDrift) * uvScale;
-                float v0 = z0 * uvScale;
-                float v1 = z1 * uvScale;
-
-                float uCenter = (u0 + u1) * 0.5f;
-                float vCenter = (v0 + v1) * 0.5f;
-
-                // Top face
-                t.color(cloudR * topBright, cloudG * topBright, cloudB * topBright, alpha);
-                t.tex(u0, v1); t.vertex(x0, y1, z1);
-                t.tex(u1, v1); t.vertex(x1, y1, z1);
-                t.tex(u1, v0); t.vertex(x1, y1, z0);
-                t.tex(u0, v0); t.vertex(x0, y1, z0);
-
-                // Bottom face
-                t.color(cloudR * bottomBright, cloudG * bottomBright, cloudB * bottomBright, alpha);
-                t.tex(u0, v0); t.vertex(x0, y0, z0);
-                t.tex(u1, v0); t.vertex(x1, y0, z0);
-                t.tex(u1, v1); t.vertex(x1, y0, z1);
-                t.tex(u0, v1); t.vertex(x0, y0, z1);
-
-                // Side faces
-                t.color(cloudR * sideBright, cloudG * sideBright, cloudB * sideBright, alpha);
-
-                // -X face
-                t.tex(uCenter, vCenter); t.vertex(x0, y0, z1);
-                t.tex(uCenter, vCenter); t.vertex(x0, y1, z1);
-                t.tex(uCenter, vCenter); t.vertex(x0, y1, z0);
-                t.tex(uCenter, vCenter); t.vertex(x0, y0, z0);
-
-                // +X face
-                t.tex(uCenter, vCenter); t.vertex(x1, y0, z0);
-                t.tex(uCenter, vCenter); t.vertex(x1, y1, z0);
-                t.tex(uCenter, vCenter); t.vertex(x1, y1, z1);
-                t.tex(uCenter, vCenter); t.vertex(x1, y0, z1);
-
-                // -Z face
-                t.tex(uCenter, vCenter); t.vertex(x0, y0, z0);
-                t.tex(uCenter, vCenter); t.vertex(x0, y1, z0);
-                t.tex(uCenter, vCenter); t.vertex(x1, y1, z0);
-                t.tex(uCenter, vCenter); t.vertex(x1, y0, z0);
-
-                // +Z face
-                t.tex(uCenter, vCenter); t.vertex(x1, y0, z1);
-                t.tex(uCenter, vCenter); t.vertex(x1, y1, z1);
-                t.tex(uCenter, vCenter); t.vertex(x0, y1, z1);
-                t.tex(uCenter, vCenter); t.vertex(x0, y0, z1);
-            }
-        }
-
-        t.end();
+        drawSkyMesh(fancyClouds, 0, fancyClouds.quads);
     }
 
+    ShaderManager::getInstance().setColorScale(1.0f, 1.0f, 1.0f, 1.0f);
+    ShaderManager::getInstance().setTexOffset(0.0f, 0.0f);
+    MatrixStack::modelview().pop();
+    ShaderManager::getInstance().updateMatrices();
+
     // Restore GL state
     device.setDepthFunc(CompareFunc::LessEqual);
     device.setDepthWrite(true);
@@ -771,60 +1076,54 @@ void LevelRenderer::renderEntities(float partialTick) {
 
     auto& device = RenderDevice::get();
     Tesselator& t = Tesselator::getInstance();
+    Textures& textures = Textures::getInstance();
 
-    // === SHADOW PASS ===
-    // Render entity shadows before the entities themselves
-    device.setBlend(true, BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
-    device.setDepthWrite(false);  // Don't write to depth buffer for shadows
+    // Shadows go down before the entities; within each pass the queue groups
+    // the draws by shader and texture
+    constexpr int SHADOW_PASS = 0;
+    constexpr int ENTITY_PASS = 1;
 
-    ShaderManager::getInstance().useWorldShader();
-    ShaderManager::getInstance().setAlphaTest(0.0f);  // No alpha test for shadows
-
-    // Bind shadow texture with clamping (prevents texture repeat at edges)
-    Textures::getInstance().bind("resources/misc/shadow.png", 0, false, true);
+    // Shadow texture with clamping (prevents texture repeat at edges)
+    TextureHandle shadowTexture = textures.loadTexture("resources/misc/shadow.png", false, true);
+    entityQueue.add(SHADOW_PASS, ShaderManager::Program::World, shadowTexture, 0.0f, [&] {
+        // Use identity modelview (camera is already set up in projection)
+        ShaderManager::getInstance().updateMatrices();
 
-    // Use identity modelview (camera is already set up in projection)
-    ShaderManager::getInstance().updateMatrices();
+        t.begin(DrawMode::Quads);
 
-    t.begin(DrawMode::Quads);
+        for (const auto& entity : level->entities) {
+            if (entity->removed) continue;
+            if (entity->getShadowRadius() <= 0.0f) continue;
 
-    for (const auto& entity : level->entities) {
-        if (entity->removed) continue;
-        if (entity->getShadowRadius() <= 0.0f) continue;
-
-        // Calculate distance-based shadow power (fades over 256 blocks)
-        double distSqr = entity->distanceToSqr(camX, camY - player->eyeHeight, camZ);
-        float power = static_cast<float>((1.0 - distSqr / (256.0 * 256.0)) * entity->getShadowStrength());
-
-        if (power > 0.0f) {
-            // Get interpolated position for smooth shadow movement
-            double shadowX = entity->prevX + (entity->x - entity->prevX) * partialTick;
-            double shadowY = entity->prevY + (entity->y - entity->prevY) * partialTick;
-            double shadowZ = entity->prevZ + (entity->z - entity->prevZ) * partialTick;
-
-            // For items being picked up, override with the animated position
-            ItemEntity* item = dynamic_cast<ItemEntity*>(entity.get());
-            if (item && item->beingPickedUp) {
-                item->getPickupAnimatedPos(partialTick, shadowX, shadowY, shadowZ);
-            }
+            // Calculate distance-based shadow power (fades over 256 blocks)
+            double distSqr = entity->distanceToSqr(camX, camY - player->eyeHeight, camZ);
+            float power = static_cast<float>((1.0 - distSqr / (256.0 * 256.0)) * entity->getShadowStrength());
 
-            renderEntityShadow(entity.get(), shadowX, shadowY, shadowZ, power, partialTick);
-        }
-    }
+            if (power > 0.0f) {
+                // Get interpolated position for smooth shadow movement
+                double shadowX = entity->prevX + (entity->x - entity->prevX) * partialTick;
+                double shadowY = entity->prevY + (entity->y - entity->prevY) * partialTick;
+                double shadowZ = entity->prevZ + (entity->z - entity->prevZ) * partialTick;
 
-    t.end();
+                // For items being picked up, override with the animated position
+                ItemEntity* item = dynamic_cast<ItemEntity*>(entity.get());
+                if (item && item->beingPickedUp) {
+                    item->getPickupAnimatedPos(partialTick, shadowX, shadowY, shadowZ);
+                }
 
-    device.setDepthWrite(true);  // Re-enable depth writing
+                renderEntityShadow(entity.get(), shadowX, shadowY, shadowZ, power, partialTick);
+            }
+        }
 
-    // === ENTITY PASS ===
-    device.setBlend(true, BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
+        t.end();
+    });
 
-    ShaderManager::getInstance().useWorldShader();
-    ShaderManager::getInstance().setAlphaTest(0.1f);
+    TextureHandle terrainTexture = textures.getTerrainTexture();
+    TextureHandle itemsTexture = textures.getItemsTexture();
 
     for (const auto& entity : level->entities) {
         ItemEntity* item = dynamic_cast<ItemEntity*>(entity.get());
-        if (!item || item->removed) continue;
+        if (!item || item->removed || item->itemId <= 0) continue;
 
         // Get interpolated position (uses pickup animation if active)
         double ix, iy, iz;
@@ -833,85 +1132,88 @@ void LevelRenderer::renderEntities(float partialTick) {
         double dx = ix - camX;
         double dy = iy - camY;
         double dz = iz - camZ;
-        if (dx * dx + dy * dy + dz * dz > 64 * 64) continue;
-
-        // Bobbing animation (disabled during pickup)
-        float bob = 0.0f;
-        float spin = 0.0f;
-        if (!item->beingPickedUp) {
-            bob = std::sin((static_cast<float>(item->age) + partialTick) / 10.0f + item->bobOffset) * 0.1f + 0.1f;
-            spin = ((static_cast<float>(item->age) + partialTick) / 20.0f + item->bobOffset) * 57.29578f;
-        }
-
-        int copies = 1;
-        if (item->count > 1) copies = 2;
-        if (item->count > 5) copies = 3;
-        if (item->count > 20) copies = 4;
-
-        unsigned int randomSeed = 187;
-
-        // Height offset to prevent clipping into ground (Java: heightOffset = bbHeight / 2.0 = 0.125)
-        float heightOffset = 0.125f;
+        double distSqr = dx * dx + dy * dy + dz * dz;
+        if (distSqr > 64 * 64) continue;
+
+        TextureHandle texture = item->itemId < 256 ? terrainTexture : itemsTexture;
+        entityQueue.add(ENTITY_PASS, ShaderManager::Program::World, texture, static_cast<float>(distSqr),
+                        [&, item, ix, iy, iz] {
+            // Bobbing animation (disabled during pickup)
+            float bob = 0.0f;
+            float spin = 0.0f;
+            if (!item->beingPickedUp) {
+                bob = std::sin((static_cast<float>(item->age) + partialTick) / 10.0f + item->bobOffset) * 0.1f + 0.1f;
+                spin = ((static_cast<float>(item->age) + partialTick) / 20.0f + item->bobOffset) * 57.29578f;
+            }
 
-        // Get light level at entity position for proper world lighting
-        int lightBlockX = static_cast<int>(std::floor(ix));
-        int lightBlockY = static_cast<int>(std::floor(iy));
-        int lightBlockZ = static_cast<int>(std::floor(iz));
-        int entitySkyLight = level->getSkyLight(lightBlockX, lightBlockY, lightBlockZ);
-        int entityBlockLight = level->getBlockLight(lightBlockX, lightBlockY, lightBlockZ);
+            int copies = 1;
+            if (item->count > 1) copies = 2;
+            if (item->count > 5) copies = 3;
+            if (item->count > 20) copies = 4;
 
-        MatrixStack::modelview().push();
-        MatrixStack::modelview().translate(static_cast<float>(ix), static_cast<float>(iy + bob + heightOffset), static_cast<float>(iz));
+            unsigned int randomSeed = 187;
 
-        if (item->itemId > 0 && item->itemId < 256) {
-            Tile* tile = Tile::tiles[item->itemId].get();
-            if (tile && TileRenderer::canRender(static_cast<int>(tile->renderShape))) {
-                Textures::getInstance().bind("resources/terrain.png");
+            // Height offset to prevent clipping into ground (Java: heightOffset = bbHeight / 2.0 = 0.125)
+            float heightOffset = 0.125f;
 
-                MatrixStack::modelview().rotate(spin, 0.0f, 1.0f, 0.0f);
+            // Get light level at entity position for proper world lighting
+            int lightBlockX = static_cast<int>(std::floor(ix));
+            int lightBlockY = static_cast<int>(std::floor(iy));
+            int lightBlockZ = static_cast<int>(std::floor(iz));
+            int entitySkyLight = level->getSkyLight(lightBlockX, lightBlockY, lightBlockZ);
+            int entityBlockLight = level->getBlockLight(lightBlockX, lightBlockY, lightBlockZ);
 
-                float scale = 0.25f;
-                if (tile->renderShape != TileShape::CUBE) {
-                    scale = 0.5f;
-                }
-                MatrixStack::modelview().scale(scale, scale, scale);
+            MatrixStack::modelview().push();
+            MatrixStack::modelview().translate(static_cast<float>(ix), static_cast<float>(iy + bob + heightOffset), static_cast<float>(iz));
 
-                ShaderManager::getInstance().updateMatrices();
+            if (item->itemId > 0 && item->itemId < 256) {
+                Tile* tile = Tile::tiles[item->itemId].get();
+                if (tile && TileRenderer::canRender(static_cast<int>(tile->renderShape))) {
+                    MatrixStack::modelview().rotate(spin, 0.0f, 1.0f, 0.0f);
 
-                for (int c = 0; c < copies; c++) {
-                    MatrixStack::modelview().push();
-                    if (c > 0) {
-                        float xo = ((randomSeed = randomSeed * 1103515245 + 12345) % 1000 / 500.0f - 1.0f) * 0.2f / scale;
-                        float yo = ((randomSeed = randomSeed * 1103515245 + 12345) % 1000 / 500.0f - 1.0f) * 0.2f / scale;
-                        float zo = ((randomSeed = randomSeed * 1103515245 + 12345) % 1000 / 500.0f - 1.0f) * 0.2f / scale;
-                        MatrixStack::modelview().translate(xo, yo, zo);
-                        ShaderManager::getInstance().updateMatrices();
+                    float scale = 0.25f;
+                    if (tile->renderShape != TileShape::CUBE) {
+                        scale = 0.5f;
                     }
-                    t.begin(DrawMode::Quads);
-                    t.lightLevel(entitySkyLight, entityBlockLight);
-                    tileRenderer.renderBlockItem(tile, 1.0f);
-                    t.end();
-                    MatrixStack::modelview().pop();
+                    MatrixStack::modelview().scale(scale, scale, scale);
+
+                    ShaderManager::getInstance().updateMatrices();
+
+                    for (int c = 0; c < copies; c++) {
+                        MatrixStack::modelview().push();
+                        if (c > 0) {
+                            float xo = ((randomSeed = randomSeed * 1103515245 + 12345) % 1000 / 500.0f - 1.0f) * 0.2f / scale;
+                            float yo = ((randomSeed = randomSeed * 1103515245 + 12345) % 1000 / 500.0f - 1.0f) * 0.2f / scale;
+                            float zo = ((randomSeed = randomSeed * 1103515245 + 12345) % 1000 / 500.0f - 1.0f) * 0.2f / scale;
+                            MatrixStack::modelview().translate(xo, yo, zo);
+                            ShaderManager::getInstance().updateMatrices();
+                        }
+                        t.begin(DrawMode::Quads);
+                        t.lightLevel(entitySkyLight, entityBlockLight);
+                        tileRenderer.renderBlockItem(tile, 1.0f);
+                        t.end();
+                        MatrixStack::modelview().pop();
+                    }
+                } else {
+                    int icon = tile ? tile->getTexture(0) : 0;
+                    ShaderManager::getInstance().updateMatrices();
+                    renderDroppedItemSprite(icon, copies, player->yRot, randomSeed, entitySkyLight, entityBlockLight);
                 }
-            } else {
-                Textures::getInstance().bind("resources/terrain.png");
-                int icon = tile ? tile->getTexture(0) : 0;
+            } else if (item->itemId >= 256) {
+                Item* itemDef = Item::byId(item->itemId);
+                int icon = itemDef ? itemDef->getIcon() : 0;
                 ShaderManager::getInstance().updateMatrices();
                 renderDroppedItemSprite(icon, copies, player->yRot, randomSeed, entitySkyLight, entityBlockLight);
             }
-        } else if (item->itemId >= 256) {
-            Textures::getInstance().bind("resources/gui/items.png");
-            Item* itemDef = Item::byId(item->itemId);
-            int icon = itemDef ? itemDef->getIcon() : 0;
-            ShaderManager::getInstance().updateMatrices();
-            renderDroppedItemSprite(icon, copies, player->yRot, randomSeed, entitySkyLight, entityBlockLight);
-        }
 
-        MatrixStack::modelview().pop();
+            MatrixStack::modelview().pop();
+        });
     }
 
-    // Render chickens
-    static ChickenModel chickenModel;
+    // Render chickens: queue each one's pose, then draw them all as one
+    // instanced batch
+    // Standard mob rendering scale
+    constexpr float scale = 0.0625f;  // 1/16
 
     for (const auto& entity : level->entities) {
         Chicken* chicken = dynamic_cast<Chicken*>(entity.get());
@@ -950,39 +1252,26 @@ void LevelRenderer::renderEntities(float partialTick) {
         int chickenSkyLight = level->getSkyLight(chickenBlockX, chickenBlockY, chickenBlockZ);
         int chickenBlockLight = level->getBlockLight(chickenBlockX, chickenBlockY, chickenBlockZ);
 
-        // Bind chicken texture (no mipmaps to avoid edge artifacts)
-        Textures::getInstance().bind("resources/mob/chicken.png", 0, false);
-
-        MatrixStack::modelview().push();
-        MatrixStack::modelview().translate(static_cast<float>(cx), static_cast<float>(cy), static_cast<float>(cz));
+        glm::mat4 pose = glm::translate(glm::mat4(1.0f), glm::vec3(static_cast<float>(cx), static_cast<float>(cy), static_cast<float>(cz)));
 
         // Rotate to face body direction
-        MatrixStack::modelview().rotate(180.0f - bodyRot, 0.0f, 1.0f, 0.0f);
+        pose = glm::rotate(pose, glm::radians(180.0f - bodyRot), glm::vec3(0.0f, 1.0f, 0.0f));
 
         // Death animation - fall over on Z axis (matching Java MobRenderer.setupRotations)
         if (chicken->deathTime > 0) {
             float fall = (static_cast<float>(chicken->deathTime) + partialTick - 1.0f) / 20.0f * 1.6f;
             fall = Mth::sqrt(fall);
             if (fall > 1.0f) fall = 1.0f;
-            MatrixStack::modelview().rotate(fall * 90.0f, 0.0f, 0.0f, 1.0f);
+            pose = glm::rotate(pose, glm::radians(fall * 90.0f), glm::vec3(0.0f, 0.0f, 1.0f));
         }
 
-        // Standard mob rendering scale
-        constexpr float scale = 0.0625f;  // 1/16
-
         // Flip model (standard Minecraft mob rendering)
-        MatrixStack::modelview().scale(-1.0f, -1.0f, 1.0f);
-        MatrixStack::modelview().translate(0.0f, -24.0f * scale - 0.0078125f, 0.0f);
-
-        ShaderManager::getInstance().updateMatrices();
+        pose = glm::scale(pose, glm::vec3(-1.0f, -1.0f, 1.0f));
+        pose = glm::translate(pose, glm::vec3(0.0f, -24.0f * scale - 0.0078125f, 0.0f));
 
-        // Setup animation
+        // Setup animation; the batch records the parts' pose as it queues
         chickenModel.setupAnim(walkPos, walkSpeed, bob, headYRot - bodyRot, headXRot);
-
-        // Disable backface culling for mob rendering (matching Java)
-        device.setCullFace(false);
-
-        chickenModel.render(t, scale, chickenSkyLight, chickenBlockLight);
+        chickenModel.batch.add(pose, 1.0f, 1.0f, 1.0f, 1.0f, chickenSkyLight, chickenBlockLight);
 
         // Red flash overlay when hurt or dying (matching Java MobRenderer lines 64-80)
         if (chicken->hurtTime > 0 || chicken->deathTime > 0) {
@@ -992,22 +1281,41 @@ void LevelRenderer::renderEntities(float partialTick) {
                 static_cast<int>(std::floor(chicken->y)),
                 static_cast<int>(std::floor(chicken->z))
             );
+            chickenModel.batch.addOverlay(pose, br, 0.0f, 0.0f, 0.4f, chickenSkyLight, chickenBlockLight);
+        }
+    }
 
-            // Enable blend for red overlay
-            device.setBlend(true, BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
-            device.setDepthFunc(CompareFunc::Equal);
+    if (!chickenModel.batch.empty()) {
+        // No mipmaps on mob textures, to avoid edge artifacts
+        TextureHandle chickenTexture = textures.loadTexture("resources/mob/chicken.png", false);
+        entityQueue.add(ENTITY_PASS, ShaderManager::Program::Model, chickenTexture, 0.0f, [&] {
+            ShaderManager::getInstance().updateMatrices();
 
-            chickenModel.render(t, scale, br, 0.0f, 0.0f, 0.4f, chickenSkyLight, chickenBlockLight);
+            // Disable backface culling for mob rendering (matching Java)
+            device.setCullFace(false);
 
-            // Restore state
+            chickenModel.batch.flush();
+
+            // Overlay only where the chickens were just drawn
+            device.setDepthFunc(CompareFunc::Equal);
+            chickenModel.batch.flushOverlay();
             device.setDepthFunc(CompareFunc::LessEqual);
-            device.setBlend(false);
-        }
 
-        device.setCullFace(true, CullMode::Back);
-        MatrixStack::modelview().pop();
+            device.setCullFace(true, CullMode::Back);
+        });
     }
 
+    device.setBlend(true, BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha);
+    entityQueue.submit([&](int pass) {
+        if (pass == SHADOW_PASS) {
+            device.setDepthWrite(false);  // Don't write to depth buffer for shadows
+            ShaderManager::getInstance().setAlphaTest(0.0f);  // No alpha test for shadows
+        } else {
+            device.setDepthWrite(true);
+            ShaderManager::getInstance().setAlphaTest(0.1f);
+        }
+    });
+    device.setDepthWrite(true);
     device.setBlend(false);
 }
 
@@ -0,0 +1,168 @@
+#include "renderer/RenderBenchmark.hpp"
+#include "renderer/LevelRenderer.hpp"
+#include "renderer/MatrixStack.hpp"
+#include "renderer/backend/null/NullRenderDevice.hpp"
+#include "world/Level.hpp"
+#include "world/LightingBenchmark.hpp"
+#include "world/tile/Tile.hpp"
+#include "util/Mth.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+namespace mc {
+
+using Clock = std::chrono::steady_clock;
+
+static double elapsedMs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+bool RenderBenchmark::run(const Config& config) {
+    if (!Tile::tiles[Tile::STONE]) {
+        Tile::initTiles();
+    }
+
+    auto nullDevice = std::make_unique<NullRenderDevice>();
+    NullRenderDevice* device = nullDevice.get();
+    device->init(nullptr);
+    RenderDevice::setInstance(std::move(nullDevice));
+
+    std::cout << "Render benchmark: " << config.width << "x" << config.height << "x" << config.depth
+              << ", " << config.frames << " frames, seed " << config.seed << std::endl;
+
+    Level level(config.width, config.height, config.depth, config.seed);
+    LightingBenchmark::generateTerrain(level, config.seed);
+
+    bool drewSomething = false;
+    {
+        LevelRenderer levelRenderer(nullptr, &level);
+
+        // Load: stay at the start of the path until the first rebuild is done
+        auto loadStart = Clock::now();
+        int loadFrames = 0;
+        double cullMs = 0.0, uploadMs = 0.0, drawMs = 0.0;
+        Camera start = getCamera(config, 0);
+        while (levelRenderer.firstRebuild) {
+            renderFrame(levelRenderer, start, cullMs, uploadMs, drawMs);
+            loadFrames++;
+        }
+        double loadMs = elapsedMs(loadStart, Clock::now());
+        NullRenderDevice::Counters load = device->getCounters();
+
+        std::cout << "  load: " << loadFrames << " frames, " << loadMs << " ms, "
+                  << load.bytesUploaded / 1024 << " KiB uploaded" << std::endl;
+
+        // Flight: circle the level, editing the surface as it goes
+        device->resetCounters();
+        std::mt19937 rng(config.seed);
+        std::uniform_int_distribution<int> rx(0, level.width - 1);
+        std::uniform_int_distribution<int> rz(0, level.depth - 1);
+        int edits = 0;
+        uint64_t chunksDrawn = 0;
+        cullMs = uploadMs = drawMs = 0.0;
+
+        for (int frame = 0; frame < config.frames; frame++) {
+            if (config.editInterval > 0 && frame % config.editInterval == 0) {
+                // Alternately dig out and light up a surface block
+                int x = rx(rng), z = rz(rng);
+                int top = level.getHeightAt(x, z);
+                if (edits % 2 == 0 && top > 1) {
+                    level.setTile(x, top - 1, z, 0);
+                } else if (top < level.height) {
+                    level.setTile(x, top, z, Tile::GLOWSTONE);
+                }
+                edits++;
+            }
+            level.updateLights();
+
+            renderFrame(levelRenderer, getCamera(config, frame), cullMs, uploadMs, drawMs);
+            chunksDrawn += static_cast<uint64_t>(levelRenderer.chunksRendered);
+        }
+
+        const NullRenderDevice::Counters& flight = device->getCounters();
+        double frames = static_cast<double>(std::max(config.frames, 1));
+        std::cout << "  flight: " << edits << " edits, per frame: "
+                  << cullMs / frames << " ms cull, "
+                  << uploadMs / frames << " ms upload, "
+                  << drawMs / frames << " ms draw" << std::endl;
+        std::cout << "  per frame: " << chunksDrawn / frames << " chunks, "
+                  << flight.drawCalls / frames << " draws in "
+                  << flight.multiDrawCalls / frames << " multi-draws, "
+                  << flight.indicesDrawn / frames << " indices, "
+                  << flight.stateChanges / frames << " state changes ("
+                  << flight.redundantStateChanges / frames << " redundant dropped), "
+                  << flight.uniformsSet / frames << " uniforms, "
+                  << flight.bytesUploaded / frames / 1024.0 << " KiB uploaded" << std::endl;
+        std::cout << "  totals: draws " << flight.drawCalls << ", indices " << flight.indicesDrawn
+                  << ", state changes " << flight.stateChanges << ", bytes " << flight.bytesUploaded
+                  << std::endl;
+
+        drewSomething = flight.drawCalls > 0;
+    }
+
+    std::cout << "Render benchmark " << (drewSomething ? "PASSED" : "FAILED") << std::endl;
+    return drewSomething;
+}
+
+RenderBenchmark::Camera RenderBenchmark::getCamera(const Config& config, int frame) {
+    // One lap of a circle around the level centre over the run, looking in
+    // at the middle from above the hills
+    double centerX = config.width * 0.5;
+    double centerZ = config.depth * 0.5;
+    double radius = std::min(config.width, config.depth) * 0.35;
+    double angle = 2.0 * Mth::PI * frame / std::max(config.frames, 1);
+
+    Camera camera;
+    camera.x = centerX + std::cos(angle) * radius;
+    camera.y = config.height * 0.5 + 20.0;
+    camera.z = centerZ + std::sin(angle) * radius;
+
+    // Yaw 0 looks along +z, as for the player
+    double dx = centerX - camera.x;
+    double dz = centerZ - camera.z;
+    camera.yaw = static_cast<float>(std::atan2(-dx, dz)) * Mth::RAD_TO_DEG;
+    camera.pitch = 25.0f;
+    return camera;
+}
+
+void RenderBenchmark::setupMatrices(const Camera& camera) {
+    // Same projection and view setup as GameRenderer, at the default window size
+    MatrixStack::projection().loadIdentity();
+    MatrixStack::projection().perspective(70.0f, 854.0f / 480.0f, 0.05f, 256.0f);
+
+    MatrixStack::modelview().loadIdentity();
+    MatrixStack::modelview().rotate(camera.pitch, 1.0f, 0.0f, 0.0f);
+    MatrixStack::modelview().rotate(camera.yaw + 180.0f, 0.0f, 1.0f, 0.0f);
+    MatrixStack::modelview().translate(static_cast<float>(-camera.x), static_cast<float>(-camera.y),
+                                       static_cast<float>(-camera.z));
+}
+
+void RenderBenchmark::renderFrame(LevelRenderer& levelRenderer, const Camera& camera,
+                                  double& cullMs, double& uploadMs, double& drawMs) {
+    setupMatrices(camera);
+
+    auto t0 = Clock::now();
+    levelRenderer.updateVisibleChunks(camera.x, camera.y, camera.z);
+    auto t1 = Clock::now();
+
+    // Let the workers finish what the last frame queued, so each frame uploads
+    // the same results whatever the thread timing (not timed)
+    levelRenderer.meshBuilder->waitIdle();
+    auto uploadStart = Clock::now();
+    levelRenderer.updateDirtyChunks();
+    auto t2 = Clock::now();
+
+    for (int pass = 0; pass < 3; pass++) {
+        levelRenderer.render(0.0f, pass);
+    }
+    auto t3 = Clock::now();
+
+    cullMs += elapsedMs(t0, t1);
+    uploadMs += elapsedMs(uploadStart, t2);
+    drawMs += elapsedMs(t2, t3);
+}
+
+} // namespace mc
@@ -1,5 +1,6 @@
 #include "renderer/ShaderManager.hpp"
 #include "renderer/backend/RenderDevice.hpp"
+#include <cstring>
 #include <iostream>
 
 namespace mc {
@@ -19,6 +20,21 @@ void ShaderManager::init() {
         std::cerr << "Failed to load world shader" << std::endl;
     }
 
+    chunkShader = device.createShaderPipeline();
+    if (!chunkShader->loadFromGLSL("shaders/chunk.vert", "shaders/world.frag")) {
+        std::cerr << "Failed to load chunk shader" << std::endl;
+    }
+
+    particleShader = device.createShaderPipeline();
+    if (!particleShader->loadFromGLSL("shaders/particle.vert", "shaders/world.frag")) {
+        std::cerr << "Failed to load particle shader" << std::endl;
+    }
+
+    modelShader = device.createShaderPipeline();
+    if (!modelShader->loadFromGLSL("shaders/model.vert", "shaders/world.frag")) {
+        std::cerr << "Failed to load model shader" << std::endl;
+    }
+
     skyShader = device.createShaderPipeline();
     if (!skyShader->loadFromGLSL("shaders/sky.vert", "shaders/sky.frag")) {
         std::cerr << "Failed to load sky shader" << std::endl;
@@ -34,48 +50,121 @@ void ShaderManager::init() {
         std::cerr << "Failed to load line shader" << std::endl;
     }
 
+    worldUniforms.resolve(*worldShader);
+    chunkUniforms.resolve(*chunkShader);
+    particleUniforms.resolve(*particleShader);
+    modelUniforms.resolve(*modelShader);
+    skyUniforms.resolve(*skyShader);
+    guiUniforms.resolve(*guiShader);
+    lineUniforms.resolve(*lineShader);
+
+    device.setFrameUniforms(frame);
+
     initialized = true;
 }
 
 void ShaderManager::destroy() {
     worldShader.reset();
+    chunkShader.reset();
+    particleShader.reset();
+    modelShader.reset();
     skyShader.reset();
     guiShader.reset();
     lineShader.reset();
+    currentShader = nullptr;
+    current = nullptr;
     initialized = false;
 }
 
-void ShaderManager::useWorldShader() {
-    worldShader->bind();
-    currentShader = worldShader.get();
+void ShaderManager::Uniforms::resolve(ShaderPipeline& shader) {
+    mvp = shader.getUniform("uMVP");
+    modelView = shader.getUniform("uModelView");
+    normalMatrix = shader.getUniform("uNormalMatrix");
+    colorScale = shader.getUniform("uColorScale");
+    texOffset = shader.getUniform("uTexOffset");
+    billboardRight = shader.getUniform("uBillboardRight");
+    billboardUp = shader.getUniform("uBillboardUp");
+    texture = shader.getUniform("uTexture");
+    useTexture = shader.getUniform("uUseTexture");
+    alphaTest = shader.getUniform("uAlphaTest");
+    color = shader.getUniform("uColor");
+    useUniformColor = shader.getUniform("uUseUniformColor");
+    enableLighting = shader.getUniform("uEnableLighting");
+    lightDir0 = shader.getUniform("uLightDir0");
+    lightDir1 = shader.getUniform("uLightDir1");
+    ambient = shader.getUniform("uAmbient");
+    diffuse = shader.getUniform("uDiffuse");
+    brightness = shader.getUniform("uBrightness");
+}
+
+void ShaderManager::use(ShaderPipeline& shader, Uniforms& shaderUniforms) {
+    shader.bind();
+    currentShader = &shader;
+    current = &shaderUniforms;
     updateMatrices();
-    worldShader->setInt("uTexture", 0);
-    worldShader->setInt("uUseTexture", 1);
-    worldShader->setFloat("uFogStart", fogStart);
-    worldShader->setFloat("uFogEnd", fogEnd);
-    worldShader->setVec3("uFogColor", fogR, fogG, fogB);
-    worldShader->setFloat("uAlphaTest", alphaThreshold);
+}
+
+void ShaderManager::setFrameUniforms(const FrameUniforms& uniforms) {
+    if (std::memcmp(&uniforms, &frame, sizeof(FrameUniforms)) == 0) return;
+    frame = uniforms;
+    RenderDevice::get().setFrameUniforms(frame);
+}
+
+void ShaderManager::useWorldShader() {
+    use(*worldShader, worldUniforms);
+    worldShader->setInt(worldUniforms.texture, 0);
+    worldShader->setInt(worldUniforms.useTexture, 1);
+    worldShader->setFloat(worldUniforms.alphaTest, alphaThreshold);
+    worldShader->setVec4(worldUniforms.colorScale, 1.0f, 1.0f, 1.0f, 1.0f);
+    worldShader->setVec2(worldUniforms.texOffset, 0.0f, 0.0f);
+}
+
+void ShaderManager::useChunkShader() {
+    use(*chunkShader, chunkUniforms);
+    chunkShader->setInt(chunkUniforms.texture, 0);
+    chunkShader->setInt(chunkUniforms.useTexture, 1);
+    chunkShader->setFloat(chunkUniforms.alphaTest, alphaThreshold);
+}
+
+void ShaderManager::useParticleShader() {
+    use(*particleShader, particleUniforms);
+    particleShader->setInt(particleUniforms.texture, 0);
+    particleShader->setInt(particleUniforms.useTexture, 1);
+    particleShader->setFloat(particleUniforms.alphaTest, alphaThreshold);
+}
+
+void ShaderManager::useModelShader() {
+    use(*modelShader, modelUniforms);
+    modelShader->setInt(modelUniforms.texture, 0);
+    modelShader->setInt(modelUniforms.useTexture, 1);
+    modelShader->setFloat(modelUniforms.alphaTest, alphaThreshold);
 }
 
 void ShaderManager::useSkyShader() {
-    skyShader->bind();
-    currentShader = skyShader.get();
-    updateMatrices();
-    skyShader->setInt("uTexture", 0);
+    use(*skyShader, skyUniforms);
+    skyShader->setInt(skyUniforms.texture, 0);
 }
 
 void ShaderManager::useGuiShader() {
-    guiShader->bind();
-    currentShader = guiShader.get();
-    updateMatrices();
-    guiShader->setInt("uTexture", 0);
-    guiShader->setFloat("uAlphaTest", 0.1f);
+    use(*guiShader, guiUniforms);
+    guiShader->setInt(guiUniforms.texture, 0);
+    guiShader->setFloat(guiUniforms.alphaTest, 0.1f);
 }
 
 void ShaderManager::useLineShader() {
-    lineShader->bind();
-    currentShader = lineShader.get();
-    updateMatrices();
+    use(*lineShader, lineUniforms);
+}
+
+void ShaderManager::use(Program program) {
+    switch (program) {
+        case Program::World: useWorldShader(); break;
+        case Program::Chunk: useChunkShader(); break;
+        case Program::Particle: useParticleShader(); break;
+        case Program::Model: useModelShader(); break;
+        case Program::Sky: useSkyShader(); break;
+        case Program::Gui: useGuiShader(); break;
+        case Program::Line: useLineShader(); break;
+    }
 }
 
 void ShaderManager::updateMatrices() {
@@ -84,108 +173,122 @@ void ShaderManager::updateMatrices() {
     glm::mat4 mvp = MatrixStack::getMVP();
     glm::mat4 mv = MatrixStack::modelview().get();
 
-    currentShader->setMat4("uMVP", glm::value_ptr(mvp));
-    currentShader->setMat4("uModelView", glm::value_ptr(mv));
+    currentShader->setMat4(current->mvp, glm::value_ptr(mvp));
+    currentShader->setMat4(current->modelView, glm::value_ptr(mv));
 }
 
 void ShaderManager::updateMatrices(const glm::mat4& projection, const glm::mat4& modelview) {
     if (!currentShader) return;
 
     glm::mat4 mvp = projection * modelview;
-    currentShader->setMat4("uMVP", glm::value_ptr(mvp));
-    currentShader->setMat4("uModelView", glm::value_ptr(modelview));
+    currentShader->setMat4(current->mvp, glm::value_ptr(mvp));
+    currentShader->setMat4(current->modelView, glm::value_ptr(modelview));
 }
 
 void ShaderManager::updateFog(float start, float end, float r, float g, float b) {
-    fogStart = start;
-    fogEnd = end;
-    fogR = r;
-    fogG = g;
-    fogB = b;
-
-    if (currentShader == worldShader.get()) {
-        worldShader->setFloat("uFogStart", fogStart);
-        worldShader->setFloat("uFogEnd", fogEnd);
-        worldShader->setVec3("uFogColor", fogR, fogG, fogB);
-    }
+    FrameUniforms next = frame;
+    next.fogColor[0] = r;
+    next.fogColor[1] = g;
+    next.fogColor[2] = b;
+    next.fogStart = start;
+    next.fogEnd = end;
+    setFrameUniforms(next);
 }
 
 void ShaderManager::setAlphaTest(float threshold) {
     alphaThreshold = threshold;
-    if (currentShader == worldShader.get()) {
-        worldShader->setFloat("uAlphaTest", alphaThreshold);
-    } else if (currentShader == guiShader.get()) {
-        guiShader->setFloat("uAlphaTest", alphaThreshold);
+    if (hasWorldFragment() || currentShader == guiShader.get()) {
+        currentShader->setFloat(current->alphaTest, alphaThreshold);
     }
 }
 
 void ShaderManager::setTexture(int unit) {
     if (currentShader) {
-        currentShader->setInt("uTexture", unit);
+        currentShader->setInt(current->texture, unit);
     }
 }
 
 void ShaderManager::setSkyColor(float r, float g, float b, float a) {
     if (currentShader == skyShader.get()) {
-        skyShader->setVec4("uColor", r, g, b, a);
-        skyShader->setInt("uUseUniformColor", 1);
+        skyShader->setVec4(skyUniforms.color, r, g, b, a);
+        skyShader->setInt(skyUniforms.useUniformColor, 1);
     }
 }
 
 void ShaderManager::setUseTexture(bool use) {
     if (currentShader) {
-        currentShader->setInt("uUseTexture", use ? 1 : 0);
+        currentShader->setInt(current->useTexture, use ? 1 : 0);
         // When using textures, use vertex colors instead of uniform color
         if (use && (currentShader == skyShader.get() || currentShader == guiShader.get())) {
-            currentShader->setInt("uUseUniformColor", 0);
+            currentShader->setInt(current->useUniformColor, 0);
         }
     }
 }
 
 void ShaderManager::setGuiColor(float r, float g, float b, float a) {
     if (currentShader == guiShader.get()) {
-        guiShader->setVec4("uColor", r, g, b, a);
-        guiShader->setInt("uUseUniformColor", 1);
+        guiShader->setVec4(guiUniforms.color, r, g, b, a);
+        guiShader->setInt(guiUniforms.useUniformColor, 1);
     }
 }
 
 void ShaderManager::setUseVertexColor(bool use) {
     if (currentShader) {
-        currentShader->setInt("uUseUniformColor", use ? 0 : 1);
+        currentShader->setInt(current->useUniformColor, use ? 0 : 1);
+    }
+}
+
+void ShaderManager::setColorScale(float r, float g, float b, float a) {
+    if (currentShader == worldShader.get()) {
+        worldShader->setVec4(worldUniforms.colorScale, r, g, b, a);
+    }
+}
+
+void ShaderManager::setTexOffset(float u, float v) {
+    if (currentShader == worldShader.get()) {
+        worldShader->setVec2(worldUniforms.texOffset, u, v);
+    }
+}
+
+void ShaderManager::setBillboardAxes(float rightX, float rightY, float rightZ,
+                                     float upX, float upY, float upZ) {
+    if (currentShader == particleShader.get()) {
+        particleShader->setVec3(particleUniforms.billboardRight, rightX, rightY, rightZ);
+        particleShader->setVec3(particleUniforms.billboardUp, upX, upY, upZ);
     }
 }
 
 void ShaderManager::enableLighting(bool enable) {
     if (currentShader == worldShader.get()) {
-        worldShader->setInt("uEnableLighting", enable ? 1 : 0);
+        worldShader->setInt(worldUniforms.enableLighting, enable ? 1 : 0);
     }
 }
 
 void ShaderManager::setLightDirections(float dir0x, float dir0y, float dir0z,
                                        float dir1x, float dir1y, float dir1z) {
     if (currentShader == worldShader.get()) {
-        worldShader->setVec3("uLightDir0", dir0x, dir0y, dir0z);
-        worldShader->setVec3("uLightDir1", dir1x, dir1y, dir1z);
+        worldShader->setVec3(worldUniforms.lightDir0, dir0x, dir0y, dir0z);
+        worldShader->setVec3(worldUniforms.lightDir1, dir1x, dir1y, dir1z);
     }
 }
 
 void ShaderManager::setLightParams(float ambient, float diffuse) {
     if (currentShader == worldShader.get()) {
-        worldShader->setFloat("uAmbient", ambient);
-        worldShader->setFloat("uDiffuse", diffuse);
+        worldShader->setFloat(worldUniforms.ambient, ambient);
+        worldShader->setFloat(worldUniforms.diffuse, diffuse);
     }
 }
 
 void ShaderManager::setBrightness(float brightness) {
     if (currentShader == worldShader.get()) {
-        worldShader->setFloat("uBrightness", brightness);
+        worldShader->setFloat(worldUniforms.brightness, brightness);
     }
 }
 
-void ShaderManager::setSkyBrightness(float skyBrightness) {
-    if (currentShader == worldShader.get()) {
-        worldShader->setFloat("uSkyBrightness", skyBrightness);
-    }
+void ShaderManager::setSkyBrightness(float brightness) {
+    FrameUniforms next = frame;
+    next.skyBrightness = brightness;
+    setFrameUniforms(next);
 }
 
 void ShaderManager::updateNormalMatrix() {
@@ -193,7 +296,7 @@ void ShaderManager::updateNormalMatrix() {
 
     glm::mat4 mv = MatrixStack::modelview().get();
     glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(mv)));
-    currentShader->setMat3("uNormalMatrix", glm::value_ptr(normalMatrix));
+    currentShader->setMat3(current->normalMatrix, glm::value_ptr(normalMatrix));
 }
 
 } // namespace mc
@@ -0,0 +1,258 @@
+#include "renderer/TerrainLod.hpp"
+#include "renderer/ChunkMeshBuilder.hpp"
+#include "renderer/TileRenderer.hpp"
+#include "renderer/Tesselator.hpp"
+#include "renderer/Frustum.hpp"
+#include "renderer/backend/RenderDevice.hpp"
+#include "renderer/backend/VertexBuffer.hpp"
+#include "world/Level.hpp"
+#include "world/tile/Tile.hpp"
+#include "util/Mth.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace mc {
+
+static constexpr int REGION_SIZE = TerrainLod::REGION_CHUNKS * 16;  // In blocks
+
+// Region builds queued per frame, so chunk builds keep most of the workers
+static constexpr int MAX_BUILDS_PER_FRAME = 2;
+
+TerrainLod::TerrainLod(Level* level)
+    : level(level)
+    , xRegions(0), zRegions(0)
+    , camX(0.0), camZ(0.0)
+    , detailDistance(0.0f)
+    , farDistance(0.0f)
+{
+    if (!level) return;
+
+    xRegions = (level->width + REGION_SIZE - 1) / REGION_SIZE;
+    zRegions = (level->depth + REGION_SIZE - 1) / REGION_SIZE;
+    regions.resize(static_cast<size_t>(xRegions) * zRegions);
+    for (int rx = 0; rx < xRegions; rx++) {
+        for (int rz = 0; rz < zRegions; rz++) {
+            Region& region = regions[rx * zRegions + rz];
+            region.x0 = rx * REGION_SIZE;
+            region.z0 = rz * REGION_SIZE;
+        }
+    }
+}
+
+TerrainLod::~TerrainLod() = default;
+
+void TerrainLod::tileChanged(int x, int z) {
+    // Neighbouring regions sample one cell past their edge for walls
+    int rx0 = std::max(Mth::floor(static_cast<double>(x - CELL_SIZE) / REGION_SIZE), 0);
+    int rz0 = std::max(Mth::floor(static_cast<double>(z - CELL_SIZE) / REGION_SIZE), 0);
+    int rx1 = std::min(Mth::floor(static_cast<double>(x + CELL_SIZE) / REGION_SIZE), xRegions - 1);
+    int rz1 = std::min(Mth::floor(static_cast<double>(z + CELL_SIZE) / REGION_SIZE), zRegions - 1);
+
+    for (int rx = rx0; rx <= rx1; rx++) {
+        for (int rz = rz0; rz <= rz1; rz++) {
+            regions[rx * zRegions + rz].dirty = true;
+        }
+    }
+}
+
+void TerrainLod::allChanged() {
+    for (Region& region : regions) {
+        region.dirty = true;
+    }
+}
+
+void TerrainLod::update(ChunkMeshBuilder& builder, double cameraX, double cameraZ, int detailChunks) {
+    camX = cameraX;
+    camZ = cameraZ;
+    detailDistance = static_cast<float>(detailChunks * 16);
+    farDistance = detailDistance * DISTANCE_SCALE;
+
+    // Stale regions reaching past the detail distance, nearest first
+    std::vector<std::pair<double, int>> candidates;
+    for (int i = 0; i < static_cast<int>(regions.size()); i++) {
+        const Region& region = regions[i];
+        if (!region.dirty || region.pending) continue;
+
+        double nearX = std::clamp(camX, static_cast<double>(region.x0), static_cast<double>(region.x0 + REGION_SIZE)) - camX;
+        double nearZ = std::clamp(camZ, static_cast<double>(region.z0), static_cast<double>(region.z0 + REGION_SIZE)) - camZ;
+        double farX = std::max(std::abs(camX - region.x0), std::abs(camX - (region.x0 + REGION_SIZE)));
+        double farZ = std::max(std::abs(camZ - region.z0), std::abs(camZ - (region.z0 + REGION_SIZE)));
+        double nearSq = nearX * nearX + nearZ * nearZ;
+        double farSq = farX * farX + farZ * farZ;
+        if (nearSq > static_cast<double>(farDistance) * farDistance ||
+            farSq <= static_cast<double>(detailDistance) * detailDistance) {
+            continue;
+        }
+        candidates.emplace_back(nearSq, i);
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    int builds = std::min(static_cast<int>(candidates.size()), MAX_BUILDS_PER_FRAME);
+    for (int i = 0; i < builds; i++) {
+        scheduleBuild(builder, candidates[i].second);
+    }
+}
+
+void TerrainLod::scheduleBuild(ChunkMeshBuilder& builder, int index) {
+    Region& region = regions[index];
+    region.dirty = false;
+    region.pending = true;
+
+    // Sampled here on the main thread, meshed on a worker
+    auto samples = std::make_shared<std::vector<Sample>>();
+    captureSamples(region, *samples);
+
+    auto mesh = std::make_shared<Mesh>();
+    int x0 = region.x0, z0 = region.z0;
+    builder.scheduleTask(
+        [samples, mesh, x0, z0](TileRenderer& renderer) { buildMesh(renderer, *samples, x0, z0, *mesh); },
+        [this, index, mesh] { upload(index, *mesh); });
+}
+
+void TerrainLod::captureSamples(const Region& region, std::vector<Sample>& samples) const {
+    samples.assign(static_cast<size_t>(SAMPLE_DIM) * SAMPLE_DIM, Sample{0, 0});
+
+    for (int cj = -1; cj <= REGION_CELLS; cj++) {
+        for (int ci = -1; ci <= REGION_CELLS; ci++) {
+            Sample& sample = samples[(cj + 1) * SAMPLE_DIM + (ci + 1)];
+            int cellX = region.x0 + ci * CELL_SIZE;
+            int cellZ = region.z0 + cj * CELL_SIZE;
+
+            // Highest column of the cell; getHeightAt is 0 outside the world
+            for (int z = cellZ; z < cellZ + CELL_SIZE; z++) {
+                for (int x = cellX; x < cellX + CELL_SIZE; x++) {
+                    int height = level->getHeightAt(x, z);
+                    if (height > sample.height) {
+                        sample.height = height;
+                        sample.tile = level->getTile(x, height - 1, z);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void TerrainLod::buildMesh(TileRenderer& renderer, const std::vector<Sample>& samples,
+                           int x0, int z0, Mesh& mesh) {
+    auto sampleAt = [&samples](int ci, int cj) -> const Sample& {
+        return samples[(cj + 1) * SAMPLE_DIM + (ci + 1)];
+    };
+
+    // Wall directions in face order: north, south, west, east
+    static const int stepI[4] = {0, 0, -1, 1};
+    static const int stepJ[4] = {-1, 1, 0, 0};
+
+    Tesselator& t = renderer.getTesselator();
+    t.begin(DrawMode::Quads);
+
+    for (int column = 0; column < REGION_COLUMNS; column++) {
+        int ci0 = (column / REGION_CHUNKS) * COLUMN_CELLS;
+        int cj0 = (column % REGION_CHUNKS) * COLUMN_CELLS;
+        mesh.columnFirst[column] = static_cast<uint32_t>(t.getVertexCount());
+
+        for (int cj = cj0; cj < cj0 + COLUMN_CELLS; cj++) {
+            for (int ci = ci0; ci < ci0 + COLUMN_CELLS; ci++) {
+                const Sample& sample = sampleAt(ci, cj);
+                if (sample.height <= 0) continue;
+                Tile* tile = Tile::tiles[sample.tile].get();
+                if (!tile) continue;
+
+                int x = x0 + ci * CELL_SIZE;
+                int z = z0 + cj * CELL_SIZE;
+                renderer.renderMergedFace(tile, 1, x, sample.height - 1, z, CELL_SIZE, CELL_SIZE);
+
+                for (int side = 0; side < 4; side++) {
+                    int ni = ci + stepI[side];
+                    int nj = cj + stepJ[side];
+
+                    // Inside the column a wall just meets the lower neighbour;
+                    // on its edge it is a skirt, since the neighbour may be a
+                    // detail chunk or another region's cells
+                    bool sameColumn = ni >= ci0 && ni < ci0 + COLUMN_CELLS &&
+                                      nj >= cj0 && nj < cj0 + COLUMN_CELLS;
+                    int neighborHeight = sampleAt(ni, nj).height;
+                    int bottom = sameColumn ? neighborHeight
+                                            : std::min(neighborHeight, sample.height) - SKIRT_DEPTH;
+                    if (bottom >= sample.height) continue;
+
+                    int wallHeight = sample.height - bottom;
+                    switch (side) {
+                        case 0: renderer.renderMergedFace(tile, 2, x, bottom, z, CELL_SIZE, wallHeight); break;
+                        case 1: renderer.renderMergedFace(tile, 3, x, bottom, z + CELL_SIZE - 1, CELL_SIZE, wallHeight); break;
+                        case 2: renderer.renderMergedFace(tile, 4, x, bottom, z, CELL_SIZE, wallHeight); break;
+                        case 3: renderer.renderMergedFace(tile, 5, x + CELL_SIZE - 1, bottom, z, CELL_SIZE, wallHeight); break;
+                    }
+                }
+            }
+        }
+
+        mesh.columnCount[column] = static_cast<uint32_t>(t.getVertexCount()) - mesh.columnFirst[column];
+    }
+
+    mesh.vertices = t.getVertexData().vertices;
+}
+
+void TerrainLod::upload(int index, Mesh& mesh) {
+    Region& region = regions[index];
+    region.pending = false;
+
+    auto& device = RenderDevice::get();
+    if (!region.buffer) {
+        region.buffer = device.createVertexBuffer();
+    }
+    region.buffer->upload(mesh.vertices.data(), mesh.vertices.size() * sizeof(int), BufferUsage::Static);
+
+    uint32_t maxCount = 0;
+    for (int column = 0; column < REGION_COLUMNS; column++) {
+        region.columnFirst[column] = mesh.columnFirst[column];
+        region.columnCount[column] = mesh.columnCount[column];
+        maxCount = std::max(maxCount, mesh.columnCount[column]);
+    }
+
+    // Grow the shared quad indices now rather than while drawing
+    if (maxCount > 0) {
+        device.getQuadIndexBuffer(maxCount / 4);
+    }
+}
+
+void TerrainLod::render(const Frustum& frustum) {
+    if (!level || farDistance <= detailDistance) return;
+
+    auto& device = RenderDevice::get();
+    IndexBuffer* quadIndices = device.getQuadIndexBuffer(0);  // Sized by upload
+    double detailSq = static_cast<double>(detailDistance) * detailDistance;
+    double farSq = static_cast<double>(farDistance) * farDistance;
+
+    for (Region& region : regions) {
+        if (!region.buffer) continue;
+
+        // One command per chunk column between the two distances. While
+        // distant terrain is on, LevelRenderer culls detail chunks by this same
+        // horizontal distance to the column centre, so a column skipped here
+        // has all its chunks in range (subject to frustum and occlusion).
+        drawCommands.clear();
+        for (int column = 0; column < REGION_COLUMNS; column++) {
+            uint32_t count = region.columnCount[column];
+            if (count == 0) continue;
+
+            int columnX = region.x0 + (column / REGION_CHUNKS) * 16;
+            int columnZ = region.z0 + (column % REGION_CHUNKS) * 16;
+            double dx = columnX + 8 - camX;
+            double dz = columnZ + 8 - camZ;
+            double distSq = dx * dx + dz * dz;
+            if (distSq <= detailSq || distSq > farSq) continue;
+            if (!frustum.isVisible(columnX, -SKIRT_DEPTH, columnZ, columnX + 16, level->height, columnZ + 16)) continue;
+
+            drawCommands.push_back({count / 4 * 6, 1, 0, static_cast<int32_t>(region.columnFirst[column]), 0});
+        }
+        if (drawCommands.empty()) continue;
+
+        region.buffer->bind();
+        device.setupVertexAttributes();
+        quadIndices->bind();
+        device.multiDrawIndexed(PrimitiveType::Triangles, drawCommands.data(), drawCommands.size());
+        region.buffer->unbind();
+    }
+}
+
+} // namespace mc
@@ -1,6 +1,8 @@
 #include "renderer/Tesselator.hpp"
 #include "renderer/backend/RenderDevice.hpp"
 #include "renderer/backend/VertexBuffer.hpp"
+#include <algorithm>
+#include <bit>
 #include <cstring>
 #include <stdexcept>
 #include <iostream>
@@ -20,9 +22,15 @@ Tesselator& Tesselator::getInstance() {
 }
 
 Tesselator::Tesselator()
+    : Tesselator(false)
+{
+}
+
+Tesselator::Tesselator(bool cpuOnly)
     : vertexBuffer(nullptr)
     , indexBuffer(nullptr)
     , vaoInitialized(false)
+    , fanTriangles(0)
     , p(0)
     , vertices(0)
     , count(0)
@@ -30,6 +38,8 @@ Tesselator::Tesselator()
     , col(0xFFFFFFFF)
     , normalValue(0)
     , lightValue(0x0F0F)  // Default: max sky light (15), max block light (15)
+    , repeatValue(0)
+    , lightSourceValue(LIGHT_SOURCE_UNKNOWN)
     , xo(0), yo(0), zo(0)
     , hasColor(false)
     , hasTexture(false)
@@ -37,12 +47,18 @@ Tesselator::Tesselator()
     , hasLight(false)
     , noColorFlag(false)
     , tesselating(false)
+    , cpuOnly(cpuOnly)
+    , lightSourceTracking(false)
     , mode(DrawMode::Quads)
 {
+    if (cpuOnly) {
+        // Sized for a typical chunk pass; vertex() grows it on demand
+        array.resize(65536);
+        return;
+    }
+
     // Pre-allocate array (2097152 ints like Java)
     array.resize(2097152);
-    // Pre-allocate index buffer for worst case (6 indices per 4 vertices)
-    indices.reserve(MAX_VERTICES * 6 / 4);
 }
 
 Tesselator::~Tesselator() {
@@ -50,7 +66,7 @@ Tesselator::~Tesselator() {
 }
 
 void Tesselator::init() {
-    if (vaoInitialized) return;
+    if (vaoInitialized || cpuOnly) return;
 
     auto& device = RenderDevice::get();
     vertexBuffer = device.createVertexBuffer();
@@ -64,6 +80,7 @@ void Tesselator::destroy() {
         indexBuffer.reset();
         vaoInitialized = false;
     }
+    fanTriangles = 0;
     array.clear();
     indices.clear();
 }
@@ -81,6 +98,7 @@ void Tesselator::begin(DrawMode drawMode) {
     hasLight = false;
     noColorFlag = false;
     lightValue = 0x0F0F;  // Reset to max light (15 sky, 15 block)
+    repeatValue = 0;
 }
 
 void Tesselator::end() {
@@ -96,64 +114,57 @@ void Tesselator::end() {
     clear();
 }
 
-void Tesselator::buildQuadIndices() {
-    indices.clear();
-    int numQuads = vertices / 4;
-    indices.reserve(numQuads * 6);
-
-    for (int i = 0; i < numQuads; i++) {
-        unsigned int base = i * 4;
-        // First triangle: v0, v1, v2
-        indices.push_back(base + 0);
-        indices.push_back(base + 1);
-        indices.push_back(base + 2);
-        // Second triangle: v0, v2, v3
-        indices.push_back(base + 0);
-        indices.push_back(base + 2);
-        indices.push_back(base + 3);
-    }
-}
-
 void Tesselator::draw() {
-    if (vertices == 0) return;
+    if (vertices == 0 || cpuOnly) return;
     if (!vaoInitialized) {
         init();
     }
 
     auto& device = RenderDevice::get();
 
-    // Upload vertex data
-    vertexBuffer->upload(array.data(), p * sizeof(int), BufferUsage::Stream);
+    // Quads draw as triangles through the device's shared quad index buffer
+    int numQuads = vertices / 4;
+    IndexBuffer* quadIndices = mode == DrawMode::Quads ? device.getQuadIndexBuffer(numQuads) : nullptr;
+
+    // Append to the streaming ring and draw from where the vertices landed
+    constexpr size_t stride = VERTEX_STRIDE * sizeof(int);
+    size_t offset = vertexBuffer->stream(array.data(), p * sizeof(int), stride);
+    int32_t baseVertex = static_cast<int32_t>(offset / stride);
     vertexBuffer->bind();
     device.setupVertexAttributes();
 
     if (mode == DrawMode::Quads) {
-        // Convert quads to triangles using index buffer
-        buildQuadIndices();
-        indexBuffer->upload(indices.data(), indices.size(), BufferUsage::Stream);
-        indexBuffer->bind();
-        device.drawIndexed(PrimitiveType::Triangles, indices.size());
+        quadIndices->bind();
+        DrawIndexedCommand cmd{static_cast<uint32_t>(numQuads) * 6, 1, 0, baseVertex, 0};
+        device.multiDrawIndexed(PrimitiveType::Triangles, &cmd, 1);
     } else if (mode == DrawMode::TriangleFan) {
-        // Convert triangle fan to triangles
-        if (vertices >= 3) {
-            indices.clear();
-            for (int i = 1; i < vertices - 1; i++) {
-                indices.push_back(0);
-                indices.push_back(i);
-                indices.push_back(i + 1);
+        // Fans draw as triangles (0, i, i+1); the pattern only depends on the
+        // triangle index, so one grown index buffer serves every fan
+        int triangles = vertices - 2;
+        if (triangles > 0) {
+            if (triangles > fanTriangles) {
+                fanTriangles = std::max(static_cast<int>(std::bit_ceil(static_cast<unsigned int>(triangles))), 64);
+                indices.clear();
+                for (int i = 1; i <= fanTriangles; i++) {
+                    indices.push_back(0);
+                    indices.push_back(i);
+                    indices.push_back(i + 1);
+                }
+                indexBuffer->upload(indices.data(), indices.size(), BufferUsage::Static);
+                indices.clear();
             }
-            indexBuffer->upload(indices.data(), indices.size(), BufferUsage::Stream);
             indexBuffer->bind();
-            device.drawIndexed(PrimitiveType::Triangles, indices.size());
+            DrawIndexedCommand cmd{static_cast<uint32_t>(triangles) * 3, 1, 0, baseVertex, 0};
+            device.multiDrawIndexed(PrimitiveType::Triangles, &cmd, 1);
         }
     } else if (mode == DrawMode::Triangles) {
-        device.draw(PrimitiveType::Triangles, vertices);
+        device.draw(PrimitiveType::Triangles, vertices, baseVertex);
     } else if (mode == DrawMode::Lines) {
-        device.draw(PrimitiveType::Lines, vertices);
+        device.draw(PrimitiveType::Lines, vertices, baseVertex);
     } else if (mode == DrawMode::LineStrip) {
-        device.draw(PrimitiveType::LineStrip, vertices);
+        device.draw(PrimitiveType::LineStrip, vertices, baseVertex);
     } else if (mode == DrawMode::Points) {
-        device.draw(PrimitiveType::Points, vertices);
+        device.draw(PrimitiveType::Points, vertices, baseVertex);
     }
 
     vertexBuffer->unbind();
@@ -164,6 +175,7 @@ void Tesselator::clear() {
     p = 0;
     count = 0;
     indices.clear();
+    lightSources.clear();
 }
 
 void Tesselator::tex(double u_, double v_) {
@@ -247,7 +259,10 @@ void Tesselator::vertex(double x, double y, double z) {
 
     // Store light values (sky light in low byte, block light in next byte)
     // Default is max light (15, 15) if not explicitly set
-    array[p + 7] = lightValue;
+    array[p + 7] = lightValue | repeatValue;
+    if (lightSourceTracking) {
+        lightSources.push_back(lightSourceValue);
+    }
 
     // Store position (with offset applied)
     array[p + 0] = floatToRawIntBits(static_cast<float>(x + xo));
@@ -257,10 +272,14 @@ void Tesselator::vertex(double x, double y, double z) {
     p += 8;  // Move to next vertex (8 ints = 32 bytes)
     vertices++;
 
-    // Auto-flush if buffer getting full
+    // Auto-flush if buffer getting full (CPU-only instances keep everything)
     if (vertices % 4 == 0 && p >= static_cast<int>(array.size()) - 32) {
-        end();
-        tesselating = true;
+        if (cpuOnly) {
+            array.resize(array.size() * 2);
+        } else {
+            end();
+            tesselating = true;
+        }
     }
 }
 
@@ -282,6 +301,24 @@ void Tesselator::lightLevel(int skyLight, int blockLight) {
     if (blockLight > 15) blockLight = 15;
     // Pack: skyLight in low byte, blockLight in next byte
     lightValue = skyLight | (blockLight << 8);
+    lightSourceValue = LIGHT_SOURCE_UNKNOWN;
+}
+
+void Tesselator::lightSource(int cell) {
+    lightSourceValue = cell;
+}
+
+void Tesselator::trackLightSources(bool track) {
+    lightSourceTracking = track;
+    lightSources.clear();
+}
+
+void Tesselator::repeatTexture(int textureIndex) {
+    if (textureIndex < 0) {
+        repeatValue = 0;
+        return;
+    }
+    repeatValue = ((textureIndex & 255) << 16) | (1 << 24);
 }
 
 void Tesselator::offset(double x, double y, double z) {
@@ -303,21 +340,11 @@ Tesselator::VertexData Tesselator::getVertexData() {
 
     // Copy vertex data
     data.vertices.assign(array.begin(), array.begin() + p);
+    data.lightSources = std::move(lightSources);
 
-    // Build indices if needed
-    if (mode == DrawMode::Quads) {
-        int numQuads = vertices / 4;
-        data.indices.reserve(numQuads * 6);
-        for (int i = 0; i < numQuads; i++) {
-            unsigned int base = i * 4;
-            data.indices.push_back(base + 0);
-            data.indices.push_back(base + 1);
-            data.indices.push_back(base + 2);
-            data.indices.push_back(base + 0);
-            data.indices.push_back(base + 2);
-            data.indices.push_back(base + 3);
-        }
-    } else if (mode == DrawMode::TriangleFan && vertices >= 3) {
+    // Build indices if needed (quads need none: they draw with the device's
+    // shared quad index buffer)
+    if (mode == DrawMode::TriangleFan && vertices >= 3) {
         for (int i = 1; i < vertices - 1; i++) {
             data.indices.push_back(0);
             data.indices.push_back(i);
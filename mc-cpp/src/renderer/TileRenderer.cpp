@@ -1,14 +1,29 @@
 #include "renderer/TileRenderer.hpp"
 #include "renderer/Tesselator.hpp"
+#include "renderer/ChunkSnapshot.hpp"
 #include "world/Level.hpp"
 #include <GL/glew.h>
+#include <cmath>
 
 namespace mc {
 
 TileRenderer::TileRenderer()
+    : TileRenderer(Tesselator::getInstance())
+{
+}
+
+TileRenderer::TileRenderer(Tesselator& tesselator)
     : level(nullptr)
     , renderAllFaces(false)
-    , t(Tesselator::getInstance())
+    , smoothLighting(false)
+    , cacheX0(0), cacheY0(0), cacheZ0(0)
+    , cacheSize(0)
+    , smoothFace(false)
+    , faceX(0), faceY(0), faceZ(0)
+    , faceNormal{0, 0, 0}
+    , faceR(1.0f), faceG(1.0f), faceB(1.0f)
+    , snapshot(nullptr)
+    , t(tesselator)
 {
 }
 
@@ -16,6 +31,24 @@ void TileRenderer::setLevel(Level* level) {
     this->level = level;
 }
 
+void TileRenderer::setSnapshot(const ChunkSnapshot* snapshot) {
+    this->snapshot = snapshot;
+}
+
+bool TileRenderer::hasWorld() const {
+    return snapshot || level;
+}
+
+Tile* TileRenderer::tileAt(int x, int y, int z) const {
+    if (snapshot) return snapshot->getTileAt(x, y, z);
+    return level ? level->getTileAt(x, y, z) : nullptr;
+}
+
+int TileRenderer::dataAt(int x, int y, int z) const {
+    if (snapshot) return snapshot->getData(x, y, z);
+    return level ? level->getData(x, y, z) : 0;
+}
+
 void TileRenderer::getUV(int textureIndex, float& u0, float& v0, float& u1, float& v1) {
     // Java calculation:
     // int xt = (tex & 15) << 4;  // column * 16
@@ -54,18 +87,133 @@ float TileRenderer::getAverageBrightness(int x0, int y0, int z0, int x1, int y1,
 }
 
 int TileRenderer::getSkyLight(int x, int y, int z) {
+    if (snapshot) return snapshot->getSkyLight(x, y, z);
     if (!level) return 15;
     return level->getSkyLight(x, y, z);
 }
 
 int TileRenderer::getBlockLight(int x, int y, int z) {
+    if (snapshot) return snapshot->getBlockLight(x, y, z);
     if (!level) return 0;
     return level->getBlockLight(x, y, z);
 }
 
+void TileRenderer::flatLight(int x, int y, int z) {
+    t.lightLevel(getSkyLight(x, y, z), getBlockLight(x, y, z));
+    if (snapshot) {
+        t.lightSource(snapshot->getCellIndex(x, y, z));
+    }
+}
+
+void TileRenderer::buildLightCache(int x0, int y0, int z0, int size) {
+    cacheSize = 0;
+    if (!hasWorld() || size <= 0) return;
+
+    cacheX0 = x0;
+    cacheY0 = y0;
+    cacheZ0 = z0;
+
+    // Sample every cell once, including a one block border so corners on the
+    // chunk faces see their neighbors. Packed as sky | block << 4 | opaque << 8.
+    int cells = size + 2;
+    cellCache.resize(static_cast<size_t>(cells) * cells * cells);
+    for (int y = 0; y < cells; y++) {
+        for (int z = 0; z < cells; z++) {
+            for (int x = 0; x < cells; x++) {
+                int wx = x0 + x - 1;
+                int wy = y0 + y - 1;
+                int wz = z0 + z - 1;
+                Tile* tile = tileAt(wx, wy, wz);
+                bool opaque = tile && !tile->transparent;
+                uint16_t packed = 0;
+                if (opaque) {
+                    packed = 1 << 8;
+                } else {
+                    packed = static_cast<uint16_t>((getSkyLight(wx, wy, wz) & 15) |
+                                                   ((getBlockLight(wx, wy, wz) & 15) << 4));
+                }
+                cellCache[(static_cast<size_t>(y) * cells + z) * cells + x] = packed;
+            }
+        }
+    }
+
+    cacheSize = size;
+}
+
+uint16_t TileRenderer::cachedCell(int x, int y, int z) const {
+    int cells = cacheSize + 2;
+    return cellCache[(static_cast<size_t>(y - cacheY0 + 1) * cells + (z - cacheZ0 + 1)) * cells + (x - cacheX0 + 1)];
+}
+
+void TileRenderer::beginSmoothFace(int x, int y, int z, int face) {
+    static const int normals[6][3] = {
+        {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}, {-1, 0, 0}, {1, 0, 0}
+    };
+    smoothFace = true;
+    faceX = x;
+    faceY = y;
+    faceZ = z;
+    faceNormal[0] = normals[face][0];
+    faceNormal[1] = normals[face][1];
+    faceNormal[2] = normals[face][2];
+}
+
+void TileRenderer::clearLightCache() {
+    cacheSize = 0;
+}
+
+void TileRenderer::vertexUV(double x, double y, double z, float u, float v) {
+    if (smoothFace) {
+        // Only the 4 cells on the lit side of the face touch the corner: the
+        // one in front of the face, the two beside it along the face's edges,
+        // and the diagonal one. Per axis, the face's own cell is in front and
+        // the corner's side of it is stepped away from the face.
+        int corner[3] = {static_cast<int>(std::lround(x)), static_cast<int>(std::lround(y)),
+                         static_cast<int>(std::lround(z))};
+        int block[3] = {faceX, faceY, faceZ};
+        int front[3], away[3];
+        for (int axis = 0; axis < 3; axis++) {
+            front[axis] = block[axis] + faceNormal[axis];
+            away[axis] = faceNormal[axis] != 0 ? front[axis]
+                       : (corner[axis] == block[axis] ? block[axis] - 1 : block[axis] + 1);
+        }
+        // The two axes in the face plane
+        int a = faceNormal[0] != 0 ? 1 : 0;
+        int b = faceNormal[2] != 0 ? 1 : 2;
+
+        auto cellFrom = [&](bool stepA, bool stepB) {
+            int cell[3] = {front[0], front[1], front[2]};
+            if (stepA) cell[a] = away[a];
+            if (stepB) cell[b] = away[b];
+            return cachedCell(cell[0], cell[1], cell[2]);
+        };
+        uint16_t cells[4] = {cellFrom(false, false), cellFrom(true, false),
+                             cellFrom(false, true), cellFrom(true, true)};
+        auto opaque = [](uint16_t c) { return (c & (1 << 8)) != 0; };
+
+        // Two opaque sides hide the diagonal cell completely, whatever it is
+        bool sidesBlocked = opaque(cells[1]) && opaque(cells[2]);
+        int occluders = sidesBlocked ? 3 : opaque(cells[1]) + opaque(cells[2]) + opaque(cells[3]);
+
+        int sky = 0, blockLight = 0, open = 0;
+        for (int i = 0; i < (sidesBlocked ? 3 : 4); i++) {
+            if (opaque(cells[i])) continue;
+            sky += cells[i] & 15;
+            blockLight += (cells[i] >> 4) & 15;
+            open++;
+        }
+
+        static constexpr float AO_BRIGHTNESS[4] = {1.0f, 0.8f, 0.65f, 0.5f};
+        float ao = AO_BRIGHTNESS[occluders];
+        t.lightLevel(open > 0 ? (sky + open / 2) / open : 0, open > 0 ? (blockLight + open / 2) / open : 0);
+        t.color(faceR * ao, faceG * ao, faceB * ao);
+    }
+    t.vertexUV(x, y, z, u, v);
+}
+
 bool TileRenderer::shouldRenderFace(int x, int y, int z, int face) {
     if (renderAllFaces) return true;
-    if (!level) return true;
+    if (!hasWorld()) return true;
 
     // Get neighbor position based on face
     int nx = x, ny = y, nz = z;
@@ -78,14 +226,14 @@ bool TileRenderer::shouldRenderFace(int x, int y, int z, int face) {
         case 5: nx++; break;  // East
     }
 
-    Tile* neighbor = level->getTileAt(nx, ny, nz);
+    Tile* neighbor = tileAt(nx, ny, nz);
     return !neighbor || neighbor->transparent;
 }
 
 bool TileRenderer::renderTileInWorld(int x, int y, int z) {
-    if (!level) return false;
+    if (!hasWorld()) return false;
 
-    Tile* tile = level->getTileAt(x, y, z);
+    Tile* tile = tileAt(x, y, z);
     if (!tile) return false;
 
     return renderTile(tile, x, y, z);
@@ -370,7 +518,7 @@ bool TileRenderer::renderTile(Tile* tile, int x, int y, int z) {
             return true;
 
         case TileShape::TORCH:
-            renderTorch(tile, x, y, z, level ? level->getData(x, y, z) : 0);
+            renderTorch(tile, x, y, z, dataAt(x, y, z));
             return true;
 
         case TileShape::LIQUID:
@@ -401,55 +549,165 @@ void TileRenderer::renderCube(Tile* tile, int x, int y, int z) {
     float grassG = 0.741f;  // 189/255
     float grassB = 0.420f;  // 107/255
 
+    // Smooth lighting reads per-vertex light from the chunk's corner cache
+    bool smooth = smoothLighting && cacheSize > 0 &&
+                  x >= cacheX0 && x < cacheX0 + cacheSize &&
+                  y >= cacheY0 && y < cacheY0 + cacheSize &&
+                  z >= cacheZ0 && z < cacheZ0 + cacheSize;
+
     // Render each face if visible
     // Now using separate light levels instead of baked brightness
     if (shouldRenderFace(x, y, z, 0)) {
-        int skyLight = getSkyLight(x, y - 1, z);
-        int blockLight = getBlockLight(x, y - 1, z);
-        t.lightLevel(skyLight, blockLight);
-        t.color(c0, c0, c0);  // Face shading only
+        if (smooth) {
+            faceR = faceG = faceB = c0;
+            beginSmoothFace(x, y, z, 0);
+        } else {
+            flatLight(x, y - 1, z);
+            t.color(c0, c0, c0);  // Face shading only
+        }
         renderFaceDown(tile, x, y, z, tile->getTexture(0));
     }
     if (shouldRenderFace(x, y, z, 1)) {
-        int skyLight = getSkyLight(x, y + 1, z);
-        int blockLight = getBlockLight(x, y + 1, z);
-        t.lightLevel(skyLight, blockLight);
         // Apply grass tint to top face
-        if (isGrass) {
-            t.color(c1 * grassR, c1 * grassG, c1 * grassB);
+        float r = isGrass ? c1 * grassR : c1;
+        float g = isGrass ? c1 * grassG : c1;
+        float b = isGrass ? c1 * grassB : c1;
+        if (smooth) {
+            faceR = r;
+            faceG = g;
+            faceB = b;
+            beginSmoothFace(x, y, z, 1);
         } else {
-            t.color(c1, c1, c1);
+            flatLight(x, y + 1, z);
+            t.color(r, g, b);
         }
         renderFaceUp(tile, x, y, z, tile->getTexture(1));
     }
     if (shouldRenderFace(x, y, z, 2)) {
-        int skyLight = getSkyLight(x, y, z - 1);
-        int blockLight = getBlockLight(x, y, z - 1);
-        t.lightLevel(skyLight, blockLight);
-        t.color(c2, c2, c2);
+        if (smooth) {
+            faceR = faceG = faceB = c2;
+            beginSmoothFace(x, y, z, 2);
+        } else {
+            flatLight(x, y, z - 1);
+            t.color(c2, c2, c2);
+        }
         renderFaceNorth(tile, x, y, z, tile->getTexture(2));
     }
     if (shouldRenderFace(x, y, z, 3)) {
-        int skyLight = getSkyLight(x, y, z + 1);
-        int blockLight = getBlockLight(x, y, z + 1);
-        t.lightLevel(skyLight, blockLight);
-        t.color(c2, c2, c2);
+        if (smooth) {
+            faceR = faceG = faceB = c2;
+            beginSmoothFace(x, y, z, 3);
+        } else {
+            flatLight(x, y, z + 1);
+            t.color(c2, c2, c2);
+        }
         renderFaceSouth(tile, x, y, z, tile->getTexture(3));
     }
     if (shouldRenderFace(x, y, z, 4)) {
-        int skyLight = getSkyLight(x - 1, y, z);
-        int blockLight = getBlockLight(x - 1, y, z);
-        t.lightLevel(skyLight, blockLight);
-        t.color(c3, c3, c3);
+        if (smooth) {
+            faceR = faceG = faceB = c3;
+            beginSmoothFace(x, y, z, 4);
+        } else {
+            flatLight(x - 1, y, z);
+            t.color(c3, c3, c3);
+        }
         renderFaceWest(tile, x, y, z, tile->getTexture(4));
     }
     if (shouldRenderFace(x, y, z, 5)) {
-        int skyLight = getSkyLight(x + 1, y, z);
-        int blockLight = getBlockLight(x + 1, y, z);
-        t.lightLevel(skyLight, blockLight);
-        t.color(c3, c3, c3);
+        if (smooth) {
+            faceR = faceG = faceB = c3;
+            beginSmoothFace(x, y, z, 5);
+        } else {
+            flatLight(x + 1, y, z);
+            t.color(c3, c3, c3);
+        }
         renderFaceEast(tile, x, y, z, tile->getTexture(5));
     }
+    smoothFace = false;
+}
+
+bool TileRenderer::canMergeFaces(Tile* tile) const {
+    // Smooth lighting varies per vertex, so merged quads would lose the gradient
+    return tile && tile->renderShape == TileShape::CUBE && !smoothLighting && !renderAllFaces;
+}
+
+uint32_t TileRenderer::getCubeFaceKey(Tile* tile, int x, int y, int z, int face) {
+    if (!shouldRenderFace(x, y, z, face)) return 0;
+
+    // Flat lighting samples the neighbor the face looks into (as renderCube does)
+    static const int dx[] = {0, 0, 0, 0, -1, 1};
+    static const int dy[] = {-1, 1, 0, 0, 0, 0};
+    static const int dz[] = {0, 0, -1, 1, 0, 0};
+    int skyLight = getSkyLight(x + dx[face], y + dy[face], z + dz[face]) & 15;
+    int blockLight = getBlockLight(x + dx[face], y + dy[face], z + dz[face]) & 15;
+
+    return (1u << 16) | (static_cast<uint32_t>(tile->id & 255) << 8) |
+           (static_cast<uint32_t>(skyLight) << 4) | static_cast<uint32_t>(blockLight);
+}
+
+void TileRenderer::renderMergedFace(Tile* tile, int face, int x, int y, int z, int w, int h) {
+    // Same face shading and grass tint as renderCube
+    static const float shade[] = {0.5f, 1.0f, 0.8f, 0.8f, 0.6f, 0.6f};
+    float r = shade[face], g = shade[face], b = shade[face];
+    if (face == 1 && tile->id == Tile::GRASS) {
+        r *= 0.486f;
+        g *= 0.741f;
+        b *= 0.420f;
+    }
+
+    static const int dx[] = {0, 0, 0, 0, -1, 1};
+    static const int dy[] = {-1, 1, 0, 0, 0, 0};
+    static const int dz[] = {0, 0, -1, 1, 0, 0};
+    flatLight(x + dx[face], y + dy[face], z + dz[face]);
+    t.color(r, g, b);
+
+    // UVs count blocks (0..w, 0..h) and the shader wraps them inside the atlas
+    // tile, so every block shows the full texture with the same orientation
+    // as the single-face functions below
+    t.repeatTexture(tile->getTexture(face));
+
+    double x0 = x, y0 = y, z0 = z;
+    float fw = static_cast<float>(w), fh = static_cast<float>(h);
+    switch (face) {
+        case 0:  // Down: u = x, v = z
+            t.vertexUV(x0,     y0, z0 + h, 0.0f, fh);
+            t.vertexUV(x0,     y0, z0,     0.0f, 0.0f);
+            t.vertexUV(x0 + w, y0, z0,     fw,   0.0f);
+            t.vertexUV(x0 + w, y0, z0 + h, fw,   fh);
+            break;
+        case 1:  // Up: u = x, v = z
+            t.vertexUV(x0,     y0 + 1, z0,     0.0f, 0.0f);
+            t.vertexUV(x0,     y0 + 1, z0 + h, 0.0f, fh);
+            t.vertexUV(x0 + w, y0 + 1, z0 + h, fw,   fh);
+            t.vertexUV(x0 + w, y0 + 1, z0,     fw,   0.0f);
+            break;
+        case 2:  // North: u = x (mirrored), v = y (top down)
+            t.vertexUV(x0,     y0 + h, z0, fw,   0.0f);
+            t.vertexUV(x0 + w, y0 + h, z0, 0.0f, 0.0f);
+            t.vertexUV(x0 + w, y0,     z0, 0.0f, fh);
+            t.vertexUV(x0,     y0,     z0, fw,   fh);
+            break;
+        case 3:  // South: u = x, v = y (top down)
+            t.vertexUV(x0,     y0,     z0 + 1, 0.0f, fh);
+            t.vertexUV(x0 + w, y0,     z0 + 1, fw,   fh);
+            t.vertexUV(x0 + w, y0 + h, z0 + 1, fw,   0.0f);
+            t.vertexUV(x0,     y0 + h, z0 + 1, 0.0f, 0.0f);
+            break;
+        case 4:  // West: u = z, v = y (top down)
+            t.vertexUV(x0, y0 + h, z0 + w, fw,   0.0f);
+            t.vertexUV(x0, y0 + h, z0,     0.0f, 0.0f);
+            t.vertexUV(x0, y0,     z0,     0.0f, fh);
+            t.vertexUV(x0, y0,     z0 + w, fw,   fh);
+            break;
+        case 5:  // East: u = z (mirrored), v = y (top down)
+            t.vertexUV(x0 + 1, y0,     z0 + w, 0.0f, fh);
+            t.vertexUV(x0 + 1, y0,     z0,     fw,   fh);
+            t.vertexUV(x0 + 1, y0 + h, z0,     fw,   0.0f);
+            t.vertexUV(x0 + 1, y0 + h, z0 + w, 0.0f, 0.0f);
+            break;
+    }
+
+    t.repeatTexture(-1);
 }
 
 // Java renderFaceUp renders the BOTTOM face (confusing naming)
@@ -458,10 +716,10 @@ void TileRenderer::renderFaceDown(Tile* /*tile*/, double x, double y, double z,
     getUV(texture, u0, v0, u1, v1);
 
     // Bottom face (y = y) - CCW winding when viewed from below
-    t.vertexUV(x,     y, z + 1, u0, v1);
-    t.vertexUV(x,     y, z,     u0, v0);
-    t.vertexUV(x + 1, y, z,     u1, v0);
-    t.vertexUV(x + 1, y, z + 1, u1, v1);
+    vertexUV(x,     y, z + 1, u0, v1);
+    vertexUV(x,     y, z,     u0, v0);
+    vertexUV(x + 1, y, z,     u1, v0);
+    vertexUV(x + 1, y, z + 1, u1, v1);
 }
 
 // Java renderFaceDown renders the TOP face (confusing naming)
@@ -470,10 +728,10 @@ void TileRenderer::renderFaceUp(Tile* /*tile*/, double x, double y, double z, in
     getUV(texture, u0, v0, u1, v1);
 
     // Top face (y = y + 1)
-    t.vertexUV(x,     y + 1, z,     u0, v0);
-    t.vertexUV(x,     y + 1, z + 1, u0, v1);
-    t.vertexUV(x + 1, y + 1, z + 1, u1, v1);
-    t.vertexUV(x + 1, y + 1, z,     u1, v0);
+    vertexUV(x,     y + 1, z,     u0, v0);
+    vertexUV(x,     y + 1, z + 1, u0, v1);
+    vertexUV(x + 1, y + 1, z + 1, u1, v1);
+    vertexUV(x + 1, y + 1, z,     u1, v0);
 }
 
 void TileRenderer::renderFaceNorth(Tile* /*tile*/, double x, double y, double z, int texture) {
@@ -481,10 +739,10 @@ void TileRenderer::renderFaceNorth(Tile* /*tile*/, double x, double y, double z,
     getUV(texture, u0, v0, u1, v1);
 
     // North face (z = z)
-    t.vertexUV(x,     y + 1, z, u1, v0);
-    t.vertexUV(x + 1, y + 1, z, u0, v0);
-    t.vertexUV(x + 1, y,     z, u0, v1);
-    t.vertexUV(x,     y,     z, u1, v1);
+    vertexUV(x,     y + 1, z, u1, v0);
+    vertexUV(x + 1, y + 1, z, u0, v0);
+    vertexUV(x + 1, y,     z, u0, v1);
+    vertexUV(x,     y,     z, u1, v1);
 }
 
 void TileRenderer::renderFaceSouth(Tile* /*tile*/, double x, double y, double z, int texture) {
@@ -492,10 +750,10 @@ void TileRenderer::renderFaceSouth(Tile* /*tile*/, double x, double y, double z,
     getUV(texture, u0, v0, u1, v1);
 
     // South face (z = z + 1)
-    t.vertexUV(x,     y,     z + 1, u0, v1);
-    t.vertexUV(x + 1, y,     z + 1, u1, v1);
-    t.vertexUV(x + 1, y + 1, z + 1, u1, v0);
-    t.vertexUV(x,     y + 1, z + 1, u0, v0);
+    vertexUV(x,     y,     z + 1, u0, v1);
+    vertexUV(x + 1, y,     z + 1, u1, v1);
+    vertexUV(x + 1, y + 1, z + 1, u1, v0);
+    vertexUV(x,     y + 1, z + 1, u0, v0);
 }
 
 void TileRenderer::renderFaceWest(Tile* /*tile*/, double x, double y, double z, int texture) {
@@ -503,10 +761,10 @@ void TileRenderer::renderFaceWest(Tile* /*tile*/, double x, double y, double z,
     getUV(texture, u0, v0, u1, v1);
 
     // West face (x = x) - Java renderWest: high Z → u1, low Z → u0
-    t.vertexUV(x, y + 1, z + 1, u1, v0);
-    t.vertexUV(x, y + 1, z,     u0, v0);
-    t.vertexUV(x, y,     z,     u0, v1);
-    t.vertexUV(x, y,     z + 1, u1, v1);
+    vertexUV(x, y + 1, z + 1, u1, v0);
+    vertexUV(x, y + 1, z,     u0, v0);
+    vertexUV(x, y,     z,     u0, v1);
+    vertexUV(x, y,     z + 1, u1, v1);
 }
 
 void TileRenderer::renderFaceEast(Tile* /*tile*/, double x, double y, double z, int texture) {
@@ -514,19 +772,17 @@ void TileRenderer::renderFaceEast(Tile* /*tile*/, double x, double y, double z,
     getUV(texture, u0, v0, u1, v1);
 
     // East face (x = x + 1) - Java renderEast: high Z → u0, low Z → u1
-    t.vertexUV(x + 1, y,     z + 1, u0, v1);
-    t.vertexUV(x + 1, y,     z,     u1, v1);
-    t.vertexUV(x + 1, y + 1, z,     u1, v0);
-    t.vertexUV(x + 1, y + 1, z + 1, u0, v0);
+    vertexUV(x + 1, y,     z + 1, u0, v1);
+    vertexUV(x + 1, y,     z,     u1, v1);
+    vertexUV(x + 1, y + 1, z,     u1, v0);
+    vertexUV(x + 1, y + 1, z + 1, u0, v0);
 }
 
 void TileRenderer::renderCross(Tile* tile, int x, int y, int z) {
     float u0, v0, u1, v1;
     getUV(tile->textureIndex, u0, v0, u1, v1);
 
-    int skyLight = getSkyLight(x, y, z);
-    int blockLight = getBlockLight(x, y, z);
-    t.lightLevel(skyLight, blockLight);
+    flatLight(x, y, z);
     t.color(1.0f, 1.0f, 1.0f);  // Full brightness, shader will apply light
 
     // Two crossed quads
@@ -572,9 +828,7 @@ void TileRenderer::renderTorch(Tile* tile, int x, int y, int z, int metadata) {
     double uc1 = static_cast<double>(u0) + 0.03515625;   // 9/256
     double vc1 = static_cast<double>(v0) + 0.03125;      // 8/256
 
-    int skyLight = getSkyLight(x, y, z);
-    int blockLight = getBlockLight(x, y, z);
-    t.lightLevel(skyLight, blockLight);
+    flatLight(x, y, z);
     t.color(1.0f, 1.0f, 1.0f);
 
     // Calculate position and tilt based on metadata (matching Java tesselateTorchInWorld lines 73-97)
@@ -668,9 +922,7 @@ void TileRenderer::renderLiquid(Tile* tile, int x, int y, int z) {
     float u0, v0, u1, v1;
     getUV(tile->textureIndex, u0, v0, u1, v1);
 
-    int skyLight = getSkyLight(x, y, z);
-    int blockLight = getBlockLight(x, y, z);
-    t.lightLevel(skyLight, blockLight);
+    flatLight(x, y, z);
     t.color(1.0f, 1.0f, 1.0f);  // Full brightness, shader will apply light
 
     // Render as slightly lowered cube
@@ -716,9 +968,7 @@ void TileRenderer::renderCactus(Tile* tile, int x, int y, int z) {
     double offset = 0.0625;  // Inset by 1/16
 
     // Get light at cactus position
-    int skyLight = getSkyLight(x, y, z);
-    int blockLight = getBlockLight(x, y, z);
-    t.lightLevel(skyLight, blockLight);
+    flatLight(x, y, z);
 
     // Sides are inset - North/South faces (0.8 multiplier)
     getUV(tile->getTexture(2), u0, v0, u1, v1);
@@ -753,16 +1003,12 @@ void TileRenderer::renderCactus(Tile* tile, int x, int y, int z) {
 
     // Top and bottom
     if (shouldRenderFace(x, y, z, 1)) {
-        int topSkyLight = getSkyLight(x, y + 1, z);
-        int topBlockLight = getBlockLight(x, y + 1, z);
-        t.lightLevel(topSkyLight, topBlockLight);
+        flatLight(x, y + 1, z);
         t.color(1.0f, 1.0f, 1.0f);  // Top face full brightness
         renderFaceUp(tile, x, y, z, tile->getTexture(1));
     }
     if (shouldRenderFace(x, y, z, 0)) {
-        int bottomSkyLight = getSkyLight(x, y - 1, z);
-        int bottomBlockLight = getBlockLight(x, y - 1, z);
-        t.lightLevel(bottomSkyLight, bottomBlockLight);
+        flatLight(x, y - 1, z);
         t.color(0.5f, 0.5f, 0.5f);  // Bottom face shading
         renderFaceDown(tile, x, y, z, tile->getTexture(0));
     }
@@ -1,5 +1,8 @@
 #include "renderer/backend/RenderDevice.hpp"
 #include <stdexcept>
+#include <algorithm>
+#include <bit>
+#include <vector>
 
 namespace mc {
 
@@ -20,4 +23,36 @@ bool RenderDevice::hasInstance() {
     return instance != nullptr;
 }
 
+IndexBuffer* RenderDevice::getQuadIndexBuffer(size_t quadCount) {
+    if (quadIndexBuffer && quadCount <= quadIndexCapacity) {
+        return quadIndexBuffer.get();
+    }
+
+    // Grow in powers of two so a rising maximum only re-uploads a few times
+    size_t capacity = std::bit_ceil(std::max<size_t>(quadCount, 16384));
+    std::vector<uint32_t> indices;
+    indices.reserve(capacity * 6);
+    for (size_t i = 0; i < capacity; i++) {
+        uint32_t base = static_cast<uint32_t>(i * 4);
+        indices.push_back(base + 0);
+        indices.push_back(base + 1);
+        indices.push_back(base + 2);
+        indices.push_back(base + 0);
+        indices.push_back(base + 2);
+        indices.push_back(base + 3);
+    }
+
+    if (!quadIndexBuffer) {
+        quadIndexBuffer = createIndexBuffer();
+    }
+    quadIndexBuffer->upload(indices.data(), indices.size(), BufferUsage::Static);
+    quadIndexCapacity = capacity;
+    return quadIndexBuffer.get();
+}
+
+void RenderDevice::releaseQuadIndexBuffer() {
+    quadIndexBuffer.reset();
+    quadIndexCapacity = 0;
+}
+
 } // namespace mc
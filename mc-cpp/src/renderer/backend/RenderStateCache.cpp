@@ -0,0 +1,73 @@
+#include "renderer/backend/RenderStateCache.hpp"
+
+namespace mc {
+
+void RenderStateCache::invalidate() {
+    *this = RenderStateCache();
+}
+
+bool RenderStateCache::setEnabled(Capability cap, bool enable) {
+    return enabled[static_cast<int>(cap)].set(enable);
+}
+
+bool RenderStateCache::setDepthWrite(bool enable) {
+    return depthWrite.set(enable);
+}
+
+bool RenderStateCache::setDepthFunc(CompareFunc func) {
+    return depthFunc.set(func);
+}
+
+bool RenderStateCache::setCullMode(CullMode mode) {
+    return cullMode.set(mode);
+}
+
+bool RenderStateCache::setFrontFace(FrontFace face) {
+    return frontFace.set(face);
+}
+
+bool RenderStateCache::setBlendFunc(BlendFactor src, BlendFactor dst) {
+    return blendFunc.set({src, dst});
+}
+
+bool RenderStateCache::setPolygonOffset(float factor, float units) {
+    return polygonOffset.set({factor, units});
+}
+
+bool RenderStateCache::setLineWidth(float width) {
+    return lineWidth.set(width);
+}
+
+bool RenderStateCache::setColorMask(bool r, bool g, bool b, bool a) {
+    return colorMask.set(static_cast<uint8_t>(r | (g << 1) | (b << 2) | (a << 3)));
+}
+
+bool RenderStateCache::useProgram(uint32_t name) {
+    return program.set(name);
+}
+
+bool RenderStateCache::setActiveTexture(int unit) {
+    return activeTexture.set(unit);
+}
+
+bool RenderStateCache::bindTexture(int unit, uint32_t texture) {
+    // Units past the tracked range are always bound
+    if (unit < 0 || unit >= MAX_TEXTURE_UNITS) return true;
+    return textures[unit].set(texture);
+}
+
+void RenderStateCache::forgetProgram(uint32_t name) {
+    if (program.known && program.value == name) {
+        program.known = false;
+    }
+}
+
+void RenderStateCache::forgetTexture(uint32_t texture) {
+    for (auto& unit : textures) {
+        if (unit.known && unit.value == texture) {
+            unit.value = 0;
+        }
+    }
+}
+
+} // namespace mc
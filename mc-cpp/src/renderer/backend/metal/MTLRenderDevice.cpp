@@ -17,6 +17,8 @@ namespace mc {
 
 // Buffer index for vertex data (must match MTLShaderPipeline::createPipelineState)
 static const int VERTEX_BUFFER_INDEX = 30;
+// Buffer index for per-draw chunk data (must match MTLShaderPipeline::createPipelineWithBlendMode)
+static const int DRAW_DATA_BUFFER_INDEX = 29;
 
 MTLRenderDevice::MTLRenderDevice()
     : device(nullptr)
@@ -44,6 +46,7 @@ MTLRenderDevice::MTLRenderDevice()
     , currentPipeline(nullptr)
     , currentVertexBuffer(nullptr)
     , currentIndexBuffer(nullptr)
+    , currentDrawDataBuffer(nullptr)
 {
 }
 
@@ -96,6 +99,7 @@ bool MTLRenderDevice::init(void* glfwWindow) {
 }
 
 void MTLRenderDevice::shutdown() {
+    releaseQuadIndexBuffer();
     if (depthTexture) {
         depthTexture->release();
         depthTexture = nullptr;
@@ -473,6 +477,11 @@ void MTLRenderDevice::setColorMask(bool r, bool g, bool b, bool a) {
     // The depth-only pass in clouds uses separate blend mode handling
 }
 
+void MTLRenderDevice::setFrameUniforms(const FrameUniforms& uniforms) {
+    // Bound with each draw, after the pipeline's own fragment uniforms
+    frameUniforms = uniforms;
+}
+
 std::unique_ptr<ShaderPipeline> MTLRenderDevice::createShaderPipeline() {
     return std::make_unique<MTLShaderPipeline>(device);
 }
@@ -520,6 +529,7 @@ void MTLRenderDevice::draw(PrimitiveType primitive, size_t vertexCount, size_t s
     if (!fragUniforms.empty()) {
         renderEncoder->setFragmentBytes(fragUniforms.data(), fragUniforms.size(), 2);
     }
+    renderEncoder->setFragmentBytes(&frameUniforms, sizeof(FrameUniforms), FrameUniforms::BINDING);
 
     // Draw
     renderEncoder->drawPrimitives(static_cast<MTL::PrimitiveType>(toMTLPrimitive(primitive)), startVertex, vertexCount);
@@ -555,6 +565,7 @@ void MTLRenderDevice::drawIndexed(PrimitiveType primitive, size_t indexCount, si
     if (!fragUniforms.empty()) {
         renderEncoder->setFragmentBytes(fragUniforms.data(), fragUniforms.size(), 2);
     }
+    renderEncoder->setFragmentBytes(&frameUniforms, sizeof(FrameUniforms), FrameUniforms::BINDING);
 
     // Get index buffer
     MTL::Buffer* ibuf = currentIndexBuffer->getBuffer();
@@ -572,9 +583,78 @@ void MTLRenderDevice::drawIndexed(PrimitiveType primitive, size_t indexCount, si
     );
 }
 
+void MTLRenderDevice::multiDrawIndexed(PrimitiveType primitive, const DrawIndexedCommand* commands,
+                                       size_t count) {
+    if (!renderEncoder || !currentPipeline || !currentVertexBuffer || !currentIndexBuffer || count == 0) {
+        return;
+    }
+
+    BlendMode effectiveMode = currentBlendMode;
+    if (currentPipeline->getDefaultBlendMode() == BlendMode::Additive) {
+        effectiveMode = BlendMode::Additive;
+    }
+    renderEncoder->setRenderPipelineState(currentPipeline->getPipelineState(effectiveMode));
+
+    MTL::Buffer* vbuf = currentVertexBuffer->getBuffer();
+    MTL::Buffer* ibuf = currentIndexBuffer->getBuffer();
+    if (!vbuf || !ibuf) {
+        return;
+    }
+    renderEncoder->setVertexBuffer(vbuf, 0, VERTEX_BUFFER_INDEX);
+    if (currentDrawDataBuffer && currentDrawDataBuffer->getBuffer()) {
+        renderEncoder->setVertexBuffer(currentDrawDataBuffer->getBuffer(), 0, DRAW_DATA_BUFFER_INDEX);
+    }
+
+    const auto& vertUniforms = currentPipeline->getVertexUniformData();
+    if (!vertUniforms.empty()) {
+        renderEncoder->setVertexBytes(vertUniforms.data(), vertUniforms.size(), 0);
+    }
+    const auto& fragUniforms = currentPipeline->getFragmentUniformData();
+    if (!fragUniforms.empty()) {
+        renderEncoder->setFragmentBytes(fragUniforms.data(), fragUniforms.size(), 2);
+    }
+    renderEncoder->setFragmentBytes(&frameUniforms, sizeof(FrameUniforms), FrameUniforms::BINDING);
+
+    // State is bound once; each command is then just a draw. Base vertex and
+    // base instance pick the chunk's vertex range and its draw-data entry.
+    auto mtlPrimitive = static_cast<MTL::PrimitiveType>(toMTLPrimitive(primitive));
+    for (size_t i = 0; i < count; i++) {
+        const DrawIndexedCommand& cmd = commands[i];
+        renderEncoder->drawIndexedPrimitives(
+            mtlPrimitive,
+            cmd.indexCount,
+            MTL::IndexTypeUInt32,
+            ibuf,
+            cmd.firstIndex * sizeof(uint32_t),
+            cmd.instanceCount,
+            cmd.baseVertex,
+            cmd.baseInstance
+        );
+    }
+}
+
 void MTLRenderDevice::setupVertexAttributes() {
     // Vertex attributes are set up in the pipeline state
     // This is configured in MTLShaderPipeline::createPipelineState()
+    currentDrawDataBuffer = nullptr;
+}
+
+void MTLRenderDevice::setupChunkVertexAttributes(VertexBuffer* drawData) {
+    // The chunk shader's pipeline state carries the packed vertex descriptor;
+    // the draw data is bound alongside the vertices at draw time
+    currentDrawDataBuffer = static_cast<MTLVertexBuffer*>(drawData);
+}
+
+void MTLRenderDevice::setupParticleVertexAttributes(VertexBuffer* instances) {
+    // Same as chunks: the particle shader's vertex descriptor steps the
+    // draw-data slot per instance
+    currentDrawDataBuffer = static_cast<MTLVertexBuffer*>(instances);
+}
+
+void MTLRenderDevice::setupModelVertexAttributes(VertexBuffer* instances) {
+    // The model shader's vertex descriptor adds per-instance part transforms
+    // at the draw-data slot; base instance selects each part's run
+    currentDrawDataBuffer = static_cast<MTLVertexBuffer*>(instances);
 }
 
 void MTLRenderDevice::setVsync(bool enabled) {
@@ -66,6 +66,7 @@ public:
 
     // Color mask
     void setColorMask(bool r, bool g, bool b, bool a) override;
+    void setFrameUniforms(const FrameUniforms& uniforms) override;
 
     // Factory methods
     std::unique_ptr<ShaderPipeline> createShaderPipeline() override;
@@ -76,9 +77,14 @@ public:
     // Draw commands
     void draw(PrimitiveType primitive, size_t vertexCount, size_t startVertex = 0) override;
     void drawIndexed(PrimitiveType primitive, size_t indexCount, size_t startIndex = 0) override;
+    void multiDrawIndexed(PrimitiveType primitive, const DrawIndexedCommand* commands,
+                          size_t count) override;
 
     // Vertex attributes
     void setupVertexAttributes() override;
+    void setupChunkVertexAttributes(VertexBuffer* drawData) override;
+    void setupParticleVertexAttributes(VertexBuffer* instances) override;
+    void setupModelVertexAttributes(VertexBuffer* instances) override;
 
     // Vsync control
     void setVsync(bool enabled) override;
@@ -144,6 +150,8 @@ private:
     MTLShaderPipeline* currentPipeline;
     MTLVertexBuffer* currentVertexBuffer;
     MTLIndexBuffer* currentIndexBuffer;
+    MTLVertexBuffer* currentDrawDataBuffer;  // Chunk origins, particle or model instances, bound at index 29
+    FrameUniforms frameUniforms{};  // Fragment buffer FrameUniforms::BINDING
 };
 
 } // namespace mc
@@ -51,6 +51,9 @@ void MTLShaderPipeline::setupUniformOffsets(const std::string& vertexPath) {
 
     // Determine shader type from path
     bool isWorldShader = (vertexPath.find("world") != std::string::npos);
+    bool isChunkShader = (vertexPath.find("chunk") != std::string::npos);
+    bool isParticleShader = (vertexPath.find("particle") != std::string::npos);
+    bool isModelShader = (vertexPath.find("model") != std::string::npos);
     bool isGuiShader = (vertexPath.find("gui") != std::string::npos);
     bool isSkyShader = (vertexPath.find("sky") != std::string::npos);
     bool isLineShader = (vertexPath.find("line") != std::string::npos);
@@ -62,25 +65,46 @@ void MTLShaderPipeline::setupUniformOffsets(const std::string& vertexPath) {
         defaultBlendMode = BlendMode::AlphaBlend;
     }
 
-    if (isWorldShader) {
-        // World shader vertex uniforms (struct has MVP, ModelView, NormalMatrix)
-        uniformOffsets["uModelView"] = 64;
-        uniformOffsets["uNormalMatrix"] = 128;
+    // Chunk shader reads the packed 12-byte chunk vertex instead of the Tesselator format
+    packedChunkVertices = isChunkShader;
+
+    // Particle shader reads billboard corners plus per-instance particles
+    particleVertices = isParticleShader;
+
+    // Model shader reads the Tesselator format plus per-instance part transforms
+    modelVertices = isModelShader;
+
+    if (isWorldShader || isChunkShader || isParticleShader || isModelShader) {
+        if (isChunkShader || isModelShader) {
+            // Chunk and model shader vertex uniforms (struct has MVP, ModelView)
+            uniformOffsets["uModelView"] = 64;
+        } else if (isParticleShader) {
+            // Particle shader vertex uniforms (struct has MVP, ModelView,
+            // BillboardRight, BillboardUp)
+            uniformOffsets["uModelView"] = 64;
+            uniformOffsets["uBillboardRight"] = 128;  // float3 (16 bytes aligned)
+            uniformOffsets["uBillboardUp"] = 144;     // float3
+        } else {
+            // World shader vertex uniforms (struct has MVP, ModelView, NormalMatrix,
+            // ColorScale, TexOffset)
+            uniformOffsets["uModelView"] = 64;
+            uniformOffsets["uNormalMatrix"] = 128;  // float3x3 (48 bytes)
+            uniformOffsets["uColorScale"] = 176;    // float4
+            uniformOffsets["uTexOffset"] = 192;     // float2
+        }
 
         // World shader fragment uniforms (buffer 2) - from generated world.frag.metal
-        // struct _33: packed_float3, float, float, float, int, int, float3, packed_float3, float, float, float, float
-        uniformOffsets["uFogColor"] = 0;        // packed_float3 (12 bytes)
-        uniformOffsets["uFogStart"] = 12;       // float
-        uniformOffsets["uFogEnd"] = 16;         // float
-        uniformOffsets["uAlphaTest"] = 20;      // float
-        uniformOffsets["uUseTexture"] = 24;     // int
-        uniformOffsets["uEnableLighting"] = 28; // int
-        uniformOffsets["uLightDir0"] = 32;      // float3 (16 bytes aligned)
-        uniformOffsets["uLightDir1"] = 48;      // packed_float3 (12 bytes)
-        uniformOffsets["uAmbient"] = 60;        // float
-        uniformOffsets["uDiffuse"] = 64;        // float
-        uniformOffsets["uBrightness"] = 68;     // float
-        uniformOffsets["uSkyBrightness"] = 72;  // float
+        // (the chunk, particle and model shaders share world.frag). Fog and sky
+        // brightness are in FrameUniforms (buffer 3), bound by the device.
+        // struct: float, int, int, float3, packed_float3, float, float, float
+        uniformOffsets["uAlphaTest"] = 0;       // float
+        uniformOffsets["uUseTexture"] = 4;      // int
+        uniformOffsets["uEnableLighting"] = 8;  // int
+        uniformOffsets["uLightDir0"] = 16;      // float3 (16 bytes aligned)
+        uniformOffsets["uLightDir1"] = 32;      // packed_float3 (12 bytes)
+        uniformOffsets["uAmbient"] = 44;        // float
+        uniformOffsets["uDiffuse"] = 48;        // float
+        uniformOffsets["uBrightness"] = 52;     // float
     }
     else if (isGuiShader) {
         // GUI shader fragment uniforms (buffer 2) - from generated gui.frag.metal
@@ -106,8 +130,15 @@ void MTLShaderPipeline::setupUniformOffsets(const std::string& vertexPath) {
         // No fragment uniforms
     }
 
-    // Texture binding - not stored in uniform buffer
-    uniformOffsets["uTexture"] = 0;
+    // uTexture is a texture binding, not in a uniform buffer, so it resolves
+    // to no uniform
+
+    uniforms.clear();
+    uniformHandles.clear();
+    for (const auto& [name, offset] : uniformOffsets) {
+        uniformHandles[name] = static_cast<UniformHandle>(uniforms.size());
+        uniforms.push_back({offset, isVertexUniform(name), name == "uMVP"});
+    }
 }
 
 bool MTLShaderPipeline::loadFromGLSL(const std::string& vertexPath, const std::string& fragmentPath) {
@@ -171,34 +202,96 @@ MTL::RenderPipelineState* MTLShaderPipeline::createPipelineWithBlendMode(BlendMo
     // Use buffer index 30 for vertex data to avoid conflict with uniform buffers (0, 1, 2)
     const int vertexBufferIndex = 30;
 
-    // Position: 3 floats at offset 0
-    vertexDesc->attributes()->object(0)->setFormat(MTL::VertexFormatFloat3);
-    vertexDesc->attributes()->object(0)->setOffset(0);
-    vertexDesc->attributes()->object(0)->setBufferIndex(vertexBufferIndex);
-
-    // TexCoord: 2 floats at offset 12
-    vertexDesc->attributes()->object(1)->setFormat(MTL::VertexFormatFloat2);
-    vertexDesc->attributes()->object(1)->setOffset(12);
-    vertexDesc->attributes()->object(1)->setBufferIndex(vertexBufferIndex);
-
-    // Color: 4 bytes normalized at offset 20
-    vertexDesc->attributes()->object(2)->setFormat(MTL::VertexFormatUChar4Normalized);
-    vertexDesc->attributes()->object(2)->setOffset(20);
-    vertexDesc->attributes()->object(2)->setBufferIndex(vertexBufferIndex);
-
-    // Normal: 3 signed bytes normalized at offset 24
-    vertexDesc->attributes()->object(3)->setFormat(MTL::VertexFormatChar3Normalized);
-    vertexDesc->attributes()->object(3)->setOffset(24);
-    vertexDesc->attributes()->object(3)->setBufferIndex(vertexBufferIndex);
-
-    // Light: 2 bytes at offset 28 (raw values 0-15, NOT normalized - shader expects 0-15 range)
-    vertexDesc->attributes()->object(4)->setFormat(MTL::VertexFormatUChar2);
-    vertexDesc->attributes()->object(4)->setOffset(28);
-    vertexDesc->attributes()->object(4)->setBufferIndex(vertexBufferIndex);
-
-    // Layout for vertex buffer at index 30
-    vertexDesc->layouts()->object(vertexBufferIndex)->setStride(32);
-    vertexDesc->layouts()->object(vertexBufferIndex)->setStepFunction(MTL::VertexStepFunctionPerVertex);
+    if (packedChunkVertices) {
+        // Packed chunk vertex: 3 uints at offset 0, decoded in chunk.vert
+        vertexDesc->attributes()->object(ChunkVertexFormat::ATTRIB_PACKED)->setFormat(MTL::VertexFormatUInt3);
+        vertexDesc->attributes()->object(ChunkVertexFormat::ATTRIB_PACKED)->setOffset(0);
+        vertexDesc->attributes()->object(ChunkVertexFormat::ATTRIB_PACKED)->setBufferIndex(vertexBufferIndex);
+        vertexDesc->layouts()->object(vertexBufferIndex)->setStride(ChunkVertexFormat::STRIDE);
+        vertexDesc->layouts()->object(vertexBufferIndex)->setStepFunction(MTL::VertexStepFunctionPerVertex);
+
+        // Chunk origin: 3 floats per instance from the draw-data buffer at index 29
+        const int drawDataBufferIndex = 29;
+        vertexDesc->attributes()->object(ChunkVertexFormat::ATTRIB_ORIGIN)->setFormat(MTL::VertexFormatFloat3);
+        vertexDesc->attributes()->object(ChunkVertexFormat::ATTRIB_ORIGIN)->setOffset(0);
+        vertexDesc->attributes()->object(ChunkVertexFormat::ATTRIB_ORIGIN)->setBufferIndex(drawDataBufferIndex);
+        vertexDesc->layouts()->object(drawDataBufferIndex)->setStride(ChunkVertexFormat::DRAW_DATA_STRIDE);
+        vertexDesc->layouts()->object(drawDataBufferIndex)->setStepFunction(MTL::VertexStepFunctionPerInstance);
+        vertexDesc->layouts()->object(drawDataBufferIndex)->setStepRate(1);
+    } else if (particleVertices) {
+        // Billboard corner: 2 floats per vertex
+        vertexDesc->attributes()->object(ParticleVertexFormat::ATTRIB_CORNER)->setFormat(MTL::VertexFormatFloat2);
+        vertexDesc->attributes()->object(ParticleVertexFormat::ATTRIB_CORNER)->setOffset(0);
+        vertexDesc->attributes()->object(ParticleVertexFormat::ATTRIB_CORNER)->setBufferIndex(vertexBufferIndex);
+        vertexDesc->layouts()->object(vertexBufferIndex)->setStride(ParticleVertexFormat::CORNER_STRIDE);
+        vertexDesc->layouts()->object(vertexBufferIndex)->setStepFunction(MTL::VertexStepFunctionPerVertex);
+
+        // Particle instances from the draw-data buffer at index 29
+        const int instanceBufferIndex = 29;
+        vertexDesc->attributes()->object(ParticleVertexFormat::ATTRIB_POSITION_SIZE)->setFormat(MTL::VertexFormatFloat4);
+        vertexDesc->attributes()->object(ParticleVertexFormat::ATTRIB_POSITION_SIZE)->setOffset(0);
+        vertexDesc->attributes()->object(ParticleVertexFormat::ATTRIB_POSITION_SIZE)->setBufferIndex(instanceBufferIndex);
+        vertexDesc->attributes()->object(ParticleVertexFormat::ATTRIB_COLOR)->setFormat(MTL::VertexFormatUChar4Normalized);
+        vertexDesc->attributes()->object(ParticleVertexFormat::ATTRIB_COLOR)->setOffset(16);
+        vertexDesc->attributes()->object(ParticleVertexFormat::ATTRIB_COLOR)->setBufferIndex(instanceBufferIndex);
+        vertexDesc->attributes()->object(ParticleVertexFormat::ATTRIB_TILE)->setFormat(MTL::VertexFormatFloat);
+        vertexDesc->attributes()->object(ParticleVertexFormat::ATTRIB_TILE)->setOffset(20);
+        vertexDesc->attributes()->object(ParticleVertexFormat::ATTRIB_TILE)->setBufferIndex(instanceBufferIndex);
+        vertexDesc->layouts()->object(instanceBufferIndex)->setStride(ParticleVertexFormat::INSTANCE_STRIDE);
+        vertexDesc->layouts()->object(instanceBufferIndex)->setStepFunction(MTL::VertexStepFunctionPerInstance);
+        vertexDesc->layouts()->object(instanceBufferIndex)->setStepRate(1);
+    } else {
+        // Position: 3 floats at offset 0
+        vertexDesc->attributes()->object(0)->setFormat(MTL::VertexFormatFloat3);
+        vertexDesc->attributes()->object(0)->setOffset(0);
+        vertexDesc->attributes()->object(0)->setBufferIndex(vertexBufferIndex);
+
+        // TexCoord: 2 floats at offset 12
+        vertexDesc->attributes()->object(1)->setFormat(MTL::VertexFormatFloat2);
+        vertexDesc->attributes()->object(1)->setOffset(12);
+        vertexDesc->attributes()->object(1)->setBufferIndex(vertexBufferIndex);
+
+        // Color: 4 bytes normalized at offset 20
+        vertexDesc->attributes()->object(2)->setFormat(MTL::VertexFormatUChar4Normalized);
+        vertexDesc->attributes()->object(2)->setOffset(20);
+        vertexDesc->attributes()->object(2)->setBufferIndex(vertexBufferIndex);
+
+        // Normal: 3 signed bytes normalized at offset 24
+        vertexDesc->attributes()->object(3)->setFormat(MTL::VertexFormatChar3Normalized);
+        vertexDesc->attributes()->object(3)->setOffset(24);
+        vertexDesc->attributes()->object(3)->setBufferIndex(vertexBufferIndex);
+
+        // Light: 4 bytes at offset 28 (sky, block, atlas tile, repeat flag), raw values
+        // NOT normalized - shader expects 0-15 light and 0-255 tile index
+        vertexDesc->attributes()->object(4)->setFormat(MTL::VertexFormatUChar4);
+        vertexDesc->attributes()->object(4)->setOffset(28);
+        vertexDesc->attributes()->object(4)->setBufferIndex(vertexBufferIndex);
+
+        // Layout for vertex buffer at index 30
+        vertexDesc->layouts()->object(vertexBufferIndex)->setStride(32);
+        vertexDesc->layouts()->object(vertexBufferIndex)->setStepFunction(MTL::VertexStepFunctionPerVertex);
+
+        if (modelVertices) {
+            // Part instances from the draw-data buffer at index 29: the model
+            // matrix as four float4 columns, then color and light
+            const int instanceBufferIndex = 29;
+            for (int column = 0; column < 4; column++) {
+                auto* attribute = vertexDesc->attributes()->object(ModelVertexFormat::ATTRIB_TRANSFORM + column);
+                attribute->setFormat(MTL::VertexFormatFloat4);
+                attribute->setOffset(column * 16);
+                attribute->setBufferIndex(instanceBufferIndex);
+            }
+            vertexDesc->attributes()->object(ModelVertexFormat::ATTRIB_COLOR)->setFormat(MTL::VertexFormatUChar4Normalized);
+            vertexDesc->attributes()->object(ModelVertexFormat::ATTRIB_COLOR)->setOffset(64);
+            vertexDesc->attributes()->object(ModelVertexFormat::ATTRIB_COLOR)->setBufferIndex(instanceBufferIndex);
+            vertexDesc->attributes()->object(ModelVertexFormat::ATTRIB_LIGHT)->setFormat(MTL::VertexFormatUChar4);
+            vertexDesc->attributes()->object(ModelVertexFormat::ATTRIB_LIGHT)->setOffset(68);
+            vertexDesc->attributes()->object(ModelVertexFormat::ATTRIB_LIGHT)->setBufferIndex(instanceBufferIndex);
+            vertexDesc->layouts()->object(instanceBufferIndex)->setStride(ModelVertexFormat::INSTANCE_STRIDE);
+            vertexDesc->layouts()->object(instanceBufferIndex)->setStepFunction(MTL::VertexStepFunctionPerInstance);
+            vertexDesc->layouts()->object(instanceBufferIndex)->setStepRate(1);
+        }
+    }
 
     desc->setVertexDescriptor(vertexDesc);
 
@@ -280,105 +373,80 @@ void MTLShaderPipeline::unbind() {
     // No-op for Metal
 }
 
-void MTLShaderPipeline::setInt(const std::string& name, int value) {
-    auto it = uniformOffsets.find(name);
-    if (it == uniformOffsets.end()) return;
-
-    std::vector<uint8_t>& buffer = isVertexUniform(name) ? vertexUniformData : fragmentUniformData;
-    if (it->second + sizeof(int) <= buffer.size()) {
-        memcpy(buffer.data() + it->second, &value, sizeof(int));
-    }
+UniformHandle MTLShaderPipeline::getUniform(const std::string& name) {
+    auto it = uniformHandles.find(name);
+    return it != uniformHandles.end() ? it->second : -1;
 }
 
-void MTLShaderPipeline::setFloat(const std::string& name, float value) {
-    auto it = uniformOffsets.find(name);
-    if (it == uniformOffsets.end()) return;
+void MTLShaderPipeline::write(UniformHandle uniform, const void* data, size_t size) {
+    if (uniform < 0) return;
 
-    std::vector<uint8_t>& buffer = isVertexUniform(name) ? vertexUniformData : fragmentUniformData;
-    if (it->second + sizeof(float) <= buffer.size()) {
-        memcpy(buffer.data() + it->second, &value, sizeof(float));
+    // The data is bound with every draw, so there is no upload to skip
+    const Uniform& u = uniforms[uniform];
+    std::vector<uint8_t>& buffer = u.vertex ? vertexUniformData : fragmentUniformData;
+    if (u.offset + size <= buffer.size()) {
+        memcpy(buffer.data() + u.offset, data, size);
     }
 }
 
-void MTLShaderPipeline::setVec2(const std::string& name, float x, float y) {
-    auto it = uniformOffsets.find(name);
-    if (it == uniformOffsets.end()) return;
+void MTLShaderPipeline::setInt(UniformHandle uniform, int value) {
+    write(uniform, &value, sizeof(int));
+}
 
-    float data[2] = {x, y};
-    std::vector<uint8_t>& buffer = isVertexUniform(name) ? vertexUniformData : fragmentUniformData;
-    if (it->second + sizeof(data) <= buffer.size()) {
-        memcpy(buffer.data() + it->second, data, sizeof(data));
-    }
+void MTLShaderPipeline::setFloat(UniformHandle uniform, float value) {
+    write(uniform, &value, sizeof(float));
 }
 
-void MTLShaderPipeline::setVec3(const std::string& name, float x, float y, float z) {
-    auto it = uniformOffsets.find(name);
-    if (it == uniformOffsets.end()) return;
+void MTLShaderPipeline::setVec2(UniformHandle uniform, float x, float y) {
+    float data[2] = {x, y};
+    write(uniform, data, sizeof(data));
+}
 
+void MTLShaderPipeline::setVec3(UniformHandle uniform, float x, float y, float z) {
     float data[3] = {x, y, z};
-    std::vector<uint8_t>& buffer = isVertexUniform(name) ? vertexUniformData : fragmentUniformData;
-    if (it->second + sizeof(data) <= buffer.size()) {
-        memcpy(buffer.data() + it->second, data, sizeof(data));
-    }
+    write(uniform, data, sizeof(data));
 }
 
-void MTLShaderPipeline::setVec4(const std::string& name, float x, float y, float z, float w) {
-    auto it = uniformOffsets.find(name);
-    if (it == uniformOffsets.end()) return;
-
+void MTLShaderPipeline::setVec4(UniformHandle uniform, float x, float y, float z, float w) {
     float data[4] = {x, y, z, w};
-    std::vector<uint8_t>& buffer = isVertexUniform(name) ? vertexUniformData : fragmentUniformData;
-    if (it->second + sizeof(data) <= buffer.size()) {
-        memcpy(buffer.data() + it->second, data, sizeof(data));
-    }
+    write(uniform, data, sizeof(data));
 }
 
-void MTLShaderPipeline::setMat3(const std::string& name, const float* matrix) {
-    auto it = uniformOffsets.find(name);
-    if (it == uniformOffsets.end()) return;
-
+void MTLShaderPipeline::setMat3(UniformHandle uniform, const float* matrix) {
     // In Metal, mat3 is stored as 3x float4 (48 bytes) for proper alignment
     // We need to expand the 3x3 matrix to this format
     float expanded[12] = {0};  // 3 rows of float4
     expanded[0] = matrix[0]; expanded[1] = matrix[1]; expanded[2] = matrix[2]; expanded[3] = 0;
     expanded[4] = matrix[3]; expanded[5] = matrix[4]; expanded[6] = matrix[5]; expanded[7] = 0;
     expanded[8] = matrix[6]; expanded[9] = matrix[7]; expanded[10] = matrix[8]; expanded[11] = 0;
-
-    std::vector<uint8_t>& buffer = isVertexUniform(name) ? vertexUniformData : fragmentUniformData;
-    if (it->second + sizeof(expanded) <= buffer.size()) {
-        memcpy(buffer.data() + it->second, expanded, sizeof(expanded));
-    }
+    write(uniform, expanded, sizeof(expanded));
 }
 
-void MTLShaderPipeline::setMat4(const std::string& name, const float* matrix) {
-    auto it = uniformOffsets.find(name);
-    if (it == uniformOffsets.end()) return;
-
-    std::vector<uint8_t>& buffer = isVertexUniform(name) ? vertexUniformData : fragmentUniformData;
-    if (it->second + 16 * sizeof(float) <= buffer.size()) {
-        if (name == "uMVP") {
-            // Apply OpenGL to Metal NDC transformation
-            // OpenGL uses Z in [-1, 1], Metal uses [0, 1]
-            // Pre-multiply MVP by bias matrix B:
-            // B = | 1  0  0   0   |
-            //     | 0  1  0   0   |
-            //     | 0  0  0.5 0.5 |
-            //     | 0  0  0   1   |
-            //
-            // Row 2 of result = 0.5 * row 2 + 0.5 * row 3
-            // In column-major: row 2 is at indices 2,6,10,14; row 3 is at 3,7,11,15
-            float adjusted[16];
-            memcpy(adjusted, matrix, 16 * sizeof(float));
-
-            adjusted[2]  = matrix[2]  * 0.5f + matrix[3]  * 0.5f;
-            adjusted[6]  = matrix[6]  * 0.5f + matrix[7]  * 0.5f;
-            adjusted[10] = matrix[10] * 0.5f + matrix[11] * 0.5f;
-            adjusted[14] = matrix[14] * 0.5f + matrix[15] * 0.5f;
-
-            memcpy(buffer.data() + it->second, adjusted, 16 * sizeof(float));
-        } else {
-            memcpy(buffer.data() + it->second, matrix, 16 * sizeof(float));
-        }
+void MTLShaderPipeline::setMat4(UniformHandle uniform, const float* matrix) {
+    if (uniform < 0) return;
+
+    if (uniforms[uniform].clipSpace) {
+        // Apply OpenGL to Metal NDC transformation
+        // OpenGL uses Z in [-1, 1], Metal uses [0, 1]
+        // Pre-multiply MVP by bias matrix B:
+        // B = | 1  0  0   0   |
+        //     | 0  1  0   0   |
+        //     | 0  0  0.5 0.5 |
+        //     | 0  0  0   1   |
+        //
+        // Row 2 of result = 0.5 * row 2 + 0.5 * row 3
+        // In column-major: row 2 is at indices 2,6,10,14; row 3 is at 3,7,11,15
+        float adjusted[16];
+        memcpy(adjusted, matrix, 16 * sizeof(float));
+
+        adjusted[2]  = matrix[2]  * 0.5f + matrix[3]  * 0.5f;
+        adjusted[6]  = matrix[6]  * 0.5f + matrix[7]  * 0.5f;
+        adjusted[10] = matrix[10] * 0.5f + matrix[11] * 0.5f;
+        adjusted[14] = matrix[14] * 0.5f + matrix[15] * 0.5f;
+
+        write(uniform, adjusted, sizeof(adjusted));
+    } else {
+        write(uniform, matrix, 16 * sizeof(float));
     }
 }
 
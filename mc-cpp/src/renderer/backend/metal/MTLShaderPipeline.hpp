@@ -34,13 +34,15 @@ public:
     void bind() override;
     void unbind() override;
 
-    void setInt(const std::string& name, int value) override;
-    void setFloat(const std::string& name, float value) override;
-    void setVec2(const std::string& name, float x, float y) override;
-    void setVec3(const std::string& name, float x, float y, float z) override;
-    void setVec4(const std::string& name, float x, float y, float z, float w) override;
-    void setMat3(const std::string& name, const float* matrix) override;
-    void setMat4(const std::string& name, const float* matrix) override;
+    UniformHandle getUniform(const std::string& name) override;
+
+    void setInt(UniformHandle uniform, int value) override;
+    void setFloat(UniformHandle uniform, float value) override;
+    void setVec2(UniformHandle uniform, float x, float y) override;
+    void setVec3(UniformHandle uniform, float x, float y, float z) override;
+    void setVec4(UniformHandle uniform, float x, float y, float z, float w) override;
+    void setMat3(UniformHandle uniform, const float* matrix) override;
+    void setMat4(UniformHandle uniform, const float* matrix) override;
 
     bool isValid() const override { return pipelineStates[0] != nullptr; }
 
@@ -61,10 +63,14 @@ private:
     bool createPipelineStates();
     MTL::RenderPipelineState* createPipelineWithBlendMode(BlendMode mode);
     void setupUniformOffsets(const std::string& vertexPath);
+    // Copy a value into the uniform's place in the vertex or fragment data
+    void write(UniformHandle uniform, const void* data, size_t size);
 
     // Helper to determine if a uniform is a vertex or fragment uniform
     bool isVertexUniform(const std::string& name) const {
-        return name == "uMVP" || name == "uModelView" || name == "uNormalMatrix";
+        return name == "uMVP" || name == "uModelView" || name == "uNormalMatrix" ||
+               name == "uColorScale" || name == "uTexOffset" ||
+               name == "uBillboardRight" || name == "uBillboardUp";
     }
 
     MTL::Device* device;
@@ -83,8 +89,26 @@ private:
     // Uniform locations/offsets
     std::unordered_map<std::string, size_t> uniformOffsets;
 
+    // Uniforms resolved from uniformOffsets once they are set up
+    struct Uniform {
+        size_t offset;
+        bool vertex;     // In the vertex rather than the fragment data
+        bool clipSpace;  // uMVP: remapped to Metal's depth range when set
+    };
+    std::vector<Uniform> uniforms;
+    std::unordered_map<std::string, UniformHandle> uniformHandles;
+
     // Default blend mode for this shader
     BlendMode defaultBlendMode = BlendMode::AlphaBlend;
+
+    // Vertex descriptor uses ChunkVertexFormat instead of the Tesselator format
+    bool packedChunkVertices = false;
+
+    // Vertex descriptor uses ParticleVertexFormat (corners plus instances)
+    bool particleVertices = false;
+
+    // Vertex descriptor adds ModelVertexFormat instances to the Tesselator format
+    bool modelVertices = false;
 };
 
 } // namespace mc
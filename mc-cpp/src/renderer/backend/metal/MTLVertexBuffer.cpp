@@ -1,15 +1,21 @@
 #include "MTLVertexBuffer.hpp"
 #include "MTLRenderDevice.hpp"
 #include <Metal/Metal.hpp>
+#include <algorithm>
+#include <bit>
 
 namespace mc {
 
+// Smallest streaming ring; a whole frame of immediate-mode draws fits in a few MB
+static constexpr size_t MIN_STREAM_CAPACITY = 4 * 1024 * 1024;
+
 // MTLVertexBuffer implementation
 
 MTLVertexBuffer::MTLVertexBuffer(MTL::Device* device)
     : device(device)
     , buffer(nullptr)
     , bufferSize(0)
+    , streamOffset(0)
 {
 }
 
@@ -27,6 +33,7 @@ void MTLVertexBuffer::destroy() {
         buffer = nullptr;
     }
     bufferSize = 0;
+    streamOffset = 0;
 }
 
 void MTLVertexBuffer::upload(const void* data, size_t sizeBytes, BufferUsage usage) {
@@ -59,6 +66,46 @@ void MTLVertexBuffer::upload(const void* data, size_t sizeBytes, BufferUsage usa
     }
 }
 
+void MTLVertexBuffer::uploadRange(const void* data, size_t offsetBytes, size_t sizeBytes) {
+    if (!buffer || !data || offsetBytes + sizeBytes > bufferSize) {
+        return;
+    }
+    memcpy(static_cast<uint8_t*>(buffer->contents()) + offsetBytes, data, sizeBytes);
+    buffer->didModifyRange(NS::Range::Make(offsetBytes, sizeBytes));
+}
+
+void MTLVertexBuffer::copyFrom(const VertexBuffer& source, size_t sizeBytes) {
+    // Shared storage: both buffers are CPU visible, so a plain copy will do
+    MTL::Buffer* sourceBuffer = static_cast<const MTLVertexBuffer&>(source).getBuffer();
+    if (!buffer || !sourceBuffer || sizeBytes > bufferSize) {
+        return;
+    }
+    memcpy(buffer->contents(), sourceBuffer->contents(), sizeBytes);
+    buffer->didModifyRange(NS::Range::Make(0, sizeBytes));
+}
+
+size_t MTLVertexBuffer::stream(const void* data, size_t sizeBytes, size_t alignment) {
+    size_t offset = (streamOffset + alignment - 1) / alignment * alignment;
+    if (!buffer || offset + sizeBytes > bufferSize) {
+        // Command buffers retain the buffers they use, so dropping ours leaves
+        // encoded draws reading the old contents
+        size_t capacity = std::max({bufferSize, std::bit_ceil(sizeBytes), MIN_STREAM_CAPACITY});
+        if (buffer) {
+            buffer->release();
+        }
+        buffer = device->newBuffer(capacity, MTL::ResourceStorageModeShared | MTL::ResourceCPUCacheModeWriteCombined);
+        bufferSize = capacity;
+        offset = 0;
+    }
+
+    if (buffer && data) {
+        memcpy(static_cast<uint8_t*>(buffer->contents()) + offset, data, sizeBytes);
+        buffer->didModifyRange(NS::Range::Make(offset, sizeBytes));
+    }
+    streamOffset = offset + sizeBytes;
+    return offset;
+}
+
 void MTLVertexBuffer::bind() {
     // Tell the render device this is the current vertex buffer
     auto& renderDevice = static_cast<MTLRenderDevice&>(RenderDevice::get());
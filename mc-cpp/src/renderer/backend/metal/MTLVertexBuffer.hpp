@@ -18,6 +18,9 @@ public:
     void create() override;
     void destroy() override;
     void upload(const void* data, size_t sizeBytes, BufferUsage usage) override;
+    void uploadRange(const void* data, size_t offsetBytes, size_t sizeBytes) override;
+    void copyFrom(const VertexBuffer& source, size_t sizeBytes) override;
+    size_t stream(const void* data, size_t sizeBytes, size_t alignment) override;
     void bind() override;
     void unbind() override;
     bool isValid() const override { return buffer != nullptr; }
@@ -28,6 +31,7 @@ private:
     MTL::Device* device;
     MTL::Buffer* buffer;
     size_t bufferSize;
+    size_t streamOffset;  // End of the last stream() write
 };
 
 class MTLIndexBuffer : public IndexBuffer {
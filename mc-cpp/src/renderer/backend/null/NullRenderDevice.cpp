@@ -0,0 +1,159 @@
+#include "NullRenderDevice.hpp"
+#include "NullResources.hpp"
+
+namespace mc {
+
+NullRenderDevice::NullRenderDevice() {}
+
+NullRenderDevice::~NullRenderDevice() {
+    shutdown();
+}
+
+bool NullRenderDevice::init(void* /*windowHandle*/) {
+    stateCache.invalidate();
+    return true;
+}
+
+void NullRenderDevice::shutdown() {
+    releaseQuadIndexBuffer();
+}
+
+void NullRenderDevice::beginFrame() {}
+
+void NullRenderDevice::endFrame() {}
+
+void NullRenderDevice::present() {}
+
+void NullRenderDevice::setViewport(int /*x*/, int /*y*/, int /*width*/, int /*height*/) {
+    counters.stateChanges++;
+}
+
+void NullRenderDevice::setClearColor(float /*r*/, float /*g*/, float /*b*/, float /*a*/) {
+    counters.stateChanges++;
+}
+
+void NullRenderDevice::clear(bool /*color*/, bool /*depth*/) {}
+
+// The state setters filter through the cache the same way GLRenderDevice
+// does, so the counters show what the cache saves
+
+void NullRenderDevice::setDepthTest(bool enabled) {
+    counters.countState(stateCache.setEnabled(RenderStateCache::Capability::DepthTest, enabled));
+}
+
+void NullRenderDevice::setDepthWrite(bool enabled) {
+    counters.countState(stateCache.setDepthWrite(enabled));
+}
+
+void NullRenderDevice::setDepthFunc(CompareFunc func) {
+    counters.countState(stateCache.setDepthFunc(func));
+}
+
+void NullRenderDevice::setCullFace(bool enabled, CullMode mode) {
+    bool cull = enabled && mode != CullMode::None;
+    bool changed = stateCache.setEnabled(RenderStateCache::Capability::CullFace, cull);
+    if (cull) {
+        changed |= stateCache.setCullMode(mode);
+    }
+    counters.countState(changed);
+}
+
+void NullRenderDevice::setFrontFace(FrontFace face) {
+    counters.countState(stateCache.setFrontFace(face));
+}
+
+void NullRenderDevice::setBlend(bool enabled, BlendFactor src, BlendFactor dst) {
+    bool changed = stateCache.setEnabled(RenderStateCache::Capability::Blend, enabled);
+    if (enabled) {
+        changed |= stateCache.setBlendFunc(src, dst);
+    }
+    counters.countState(changed);
+}
+
+void NullRenderDevice::setPolygonOffset(bool enabled, float factor, float units) {
+    bool changed = stateCache.setEnabled(RenderStateCache::Capability::PolygonOffset, enabled);
+    if (enabled) {
+        changed |= stateCache.setPolygonOffset(factor, units);
+    }
+    counters.countState(changed);
+}
+
+void NullRenderDevice::setLineWidth(float width) {
+    counters.countState(stateCache.setLineWidth(width));
+}
+
+void NullRenderDevice::setColorMask(bool r, bool g, bool b, bool a) {
+    counters.countState(stateCache.setColorMask(r, g, b, a));
+}
+
+void NullRenderDevice::setFrameUniforms(const FrameUniforms& /*uniforms*/) {
+    counters.uniformsSet++;
+}
+
+std::unique_ptr<ShaderPipeline> NullRenderDevice::createShaderPipeline() {
+    return std::make_unique<NullShaderPipeline>(counters, stateCache, nextObjectName++);
+}
+
+std::unique_ptr<VertexBuffer> NullRenderDevice::createVertexBuffer() {
+    auto buffer = std::make_unique<NullVertexBuffer>(counters);
+    buffer->create();
+    return buffer;
+}
+
+std::unique_ptr<IndexBuffer> NullRenderDevice::createIndexBuffer() {
+    auto buffer = std::make_unique<NullIndexBuffer>(counters);
+    buffer->create();
+    return buffer;
+}
+
+std::unique_ptr<Texture> NullRenderDevice::createTexture() {
+    auto texture = std::make_unique<NullTexture>(counters, stateCache, nextObjectName++);
+    texture->create();
+    return texture;
+}
+
+void NullRenderDevice::draw(PrimitiveType /*primitive*/, size_t vertexCount, size_t /*startVertex*/) {
+    counters.drawCalls++;
+    counters.verticesDrawn += vertexCount;
+}
+
+void NullRenderDevice::drawIndexed(PrimitiveType /*primitive*/, size_t indexCount, size_t /*startIndex*/) {
+    counters.drawCalls++;
+    counters.indicesDrawn += indexCount;
+}
+
+void NullRenderDevice::multiDrawIndexed(PrimitiveType /*primitive*/, const DrawIndexedCommand* commands,
+                                        size_t count) {
+    counters.multiDrawCalls++;
+    for (size_t i = 0; i < count; i++) {
+        counters.drawCalls++;
+        counters.indicesDrawn += static_cast<uint64_t>(commands[i].indexCount) * commands[i].instanceCount;
+    }
+}
+
+bool NullRenderDevice::beginRenderToTexture(Texture* texture) {
+    counters.stateChanges++;
+    return texture && texture->isValid();
+}
+
+void NullRenderDevice::endRenderToTexture() {
+    counters.stateChanges++;
+}
+
+void NullRenderDevice::setupVertexAttributes() {
+    counters.stateChanges++;
+}
+
+void NullRenderDevice::setupChunkVertexAttributes(VertexBuffer* /*drawData*/) {
+    counters.stateChanges++;
+}
+
+void NullRenderDevice::setupParticleVertexAttributes(VertexBuffer* /*instances*/) {
+    counters.stateChanges++;
+}
+
+void NullRenderDevice::setupModelVertexAttributes(VertexBuffer* /*instances*/) {
+    counters.stateChanges++;
+}
+
+} // namespace mc
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "renderer/backend/RenderDevice.hpp"
+#include <cstdint>
+
+namespace mc {
+
+// Backend that talks to no graphics API: buffers, textures and shaders keep
+// only their sizes, and every call is counted instead of executed. Lets the
+// render path (meshing, culling, uploads, draw submission) run and be measured
+// without a window. Selected by --render-bench.
+class NullRenderDevice : public RenderDevice {
+public:
+    struct Counters {
+        uint64_t bytesUploaded = 0;   // Vertex, index and texture data sent to the device
+        uint64_t drawCalls = 0;       // Draws issued, counting each multi-draw command
+        uint64_t multiDrawCalls = 0;  // multiDrawIndexed calls
+        uint64_t indicesDrawn = 0;
+        uint64_t verticesDrawn = 0;   // Non-indexed draws
+        uint64_t stateChanges = 0;    // State setters, binds and attribute setups that reach the device
+        uint64_t redundantStateChanges = 0;  // State setters and binds the state cache dropped
+        uint64_t uniformsSet = 0;
+
+        void countState(bool changed) { changed ? stateChanges++ : redundantStateChanges++; }
+    };
+
+    NullRenderDevice();
+    ~NullRenderDevice() override;
+
+    // Lifecycle
+    bool init(void* windowHandle) override;
+    void shutdown() override;
+
+    // Frame management
+    void beginFrame() override;
+    void endFrame() override;
+    void present() override;
+
+    // Viewport and clear
+    void setViewport(int x, int y, int width, int height) override;
+    void setClearColor(float r, float g, float b, float a) override;
+    void clear(bool color, bool depth) override;
+
+    // Depth state
+    void setDepthTest(bool enabled) override;
+    void setDepthWrite(bool enabled) override;
+    void setDepthFunc(CompareFunc func) override;
+
+    // Culling
+    void setCullFace(bool enabled, CullMode mode = CullMode::Back) override;
+    void setFrontFace(FrontFace face) override;
+
+    // Blending
+    void setBlend(bool enabled, BlendFactor src = BlendFactor::SrcAlpha,
+                 BlendFactor dst = BlendFactor::OneMinusSrcAlpha) override;
+
+    // Polygon offset
+    void setPolygonOffset(bool enabled, float factor = 0.0f, float units = 0.0f) override;
+
+    // Line width
+    void setLineWidth(float width) override;
+
+    // Color mask
+    void setColorMask(bool r, bool g, bool b, bool a) override;
+    void setFrameUniforms(const FrameUniforms& uniforms) override;
+
+    // Factory methods
+    std::unique_ptr<ShaderPipeline> createShaderPipeline() override;
+    std::unique_ptr<VertexBuffer> createVertexBuffer() override;
+    std::unique_ptr<IndexBuffer> createIndexBuffer() override;
+    std::unique_ptr<Texture> createTexture() override;
+
+    // Draw commands
+    void draw(PrimitiveType primitive, size_t vertexCount, size_t startVertex = 0) override;
+    void drawIndexed(PrimitiveType primitive, size_t indexCount, size_t startIndex = 0) override;
+    void multiDrawIndexed(PrimitiveType primitive, const DrawIndexedCommand* commands,
+                          size_t count) override;
+
+    // Vertex attributes
+    void setupVertexAttributes() override;
+    void setupChunkVertexAttributes(VertexBuffer* drawData) override;
+    void setupParticleVertexAttributes(VertexBuffer* instances) override;
+    void setupModelVertexAttributes(VertexBuffer* instances) override;
+
+    // Succeeds, so paths that build textures by rendering run and are counted
+    bool beginRenderToTexture(Texture* texture) override;
+    void endRenderToTexture() override;
+
+    const Counters& getCounters() const { return counters; }
+    void resetCounters() { counters = Counters(); }
+
+private:
+    Counters counters;
+    uint32_t nextObjectName = 1;  // Stands in for API object names in the state cache
+};
+
+} // namespace mc
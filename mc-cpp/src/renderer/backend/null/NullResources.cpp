@@ -0,0 +1,198 @@
+#include "NullResources.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace mc {
+
+// NullShaderPipeline implementation
+
+NullShaderPipeline::NullShaderPipeline(NullRenderDevice::Counters& counters, RenderStateCache& stateCache,
+                                       uint32_t name)
+    : counters(counters), stateCache(stateCache), name(name), loaded(false) {}
+
+NullShaderPipeline::~NullShaderPipeline() {
+    stateCache.forgetProgram(name);
+}
+
+bool NullShaderPipeline::loadFromGLSL(const std::string& /*vertexPath*/, const std::string& /*fragmentPath*/) {
+    loaded = true;
+    return true;
+}
+
+void NullShaderPipeline::bind() {
+    counters.countState(stateCache.useProgram(name));
+}
+
+void NullShaderPipeline::unbind() {
+    counters.countState(stateCache.useProgram(0));
+}
+
+UniformHandle NullShaderPipeline::getUniform(const std::string& name) {
+    auto it = uniformHandles.find(name);
+    if (it != uniformHandles.end()) {
+        return it->second;
+    }
+    UniformHandle handle = static_cast<UniformHandle>(uniformHandles.size());
+    uniformHandles[name] = handle;
+    return handle;
+}
+
+void NullShaderPipeline::setInt(UniformHandle /*uniform*/, int /*value*/) {
+    counters.uniformsSet++;
+}
+
+void NullShaderPipeline::setFloat(UniformHandle /*uniform*/, float /*value*/) {
+    counters.uniformsSet++;
+}
+
+void NullShaderPipeline::setVec2(UniformHandle /*uniform*/, float /*x*/, float /*y*/) {
+    counters.uniformsSet++;
+}
+
+void NullShaderPipeline::setVec3(UniformHandle /*uniform*/, float /*x*/, float /*y*/, float /*z*/) {
+    counters.uniformsSet++;
+}
+
+void NullShaderPipeline::setVec4(UniformHandle /*uniform*/, float /*x*/, float /*y*/, float /*z*/, float /*w*/) {
+    counters.uniformsSet++;
+}
+
+void NullShaderPipeline::setMat3(UniformHandle /*uniform*/, const float* /*matrix*/) {
+    counters.uniformsSet++;
+}
+
+void NullShaderPipeline::setMat4(UniformHandle /*uniform*/, const float* /*matrix*/) {
+    counters.uniformsSet++;
+}
+
+// NullVertexBuffer implementation
+
+NullVertexBuffer::NullVertexBuffer(NullRenderDevice::Counters& counters)
+    : counters(counters), size(0), streamOffset(0), created(false) {}
+
+void NullVertexBuffer::create() {
+    created = true;
+}
+
+void NullVertexBuffer::destroy() {
+    created = false;
+    size = 0;
+    streamOffset = 0;
+}
+
+void NullVertexBuffer::upload(const void* data, size_t sizeBytes, BufferUsage /*usage*/) {
+    // upload(nullptr, ...) only allocates
+    size = sizeBytes;
+    if (data) {
+        counters.bytesUploaded += sizeBytes;
+    }
+}
+
+void NullVertexBuffer::uploadRange(const void* /*data*/, size_t /*offsetBytes*/, size_t sizeBytes) {
+    counters.bytesUploaded += sizeBytes;
+}
+
+void NullVertexBuffer::copyFrom(const VertexBuffer& /*source*/, size_t /*sizeBytes*/) {
+    // Device-side copy, nothing crosses the bus
+}
+
+size_t NullVertexBuffer::stream(const void* /*data*/, size_t sizeBytes, size_t alignment) {
+    // Same ring arithmetic as the real backends, so offsets match theirs
+    size_t offset = (streamOffset + alignment - 1) / alignment * alignment;
+    if (offset + sizeBytes > size) {
+        size = std::max({size, std::bit_ceil(sizeBytes), static_cast<size_t>(4 * 1024 * 1024)});
+        offset = 0;
+    }
+    counters.bytesUploaded += sizeBytes;
+    streamOffset = offset + sizeBytes;
+    return offset;
+}
+
+void NullVertexBuffer::bind() {
+    counters.stateChanges++;
+}
+
+void NullVertexBuffer::unbind() {
+    counters.stateChanges++;
+}
+
+// NullIndexBuffer implementation
+
+NullIndexBuffer::NullIndexBuffer(NullRenderDevice::Counters& counters)
+    : counters(counters), indexCount(0), created(false) {}
+
+void NullIndexBuffer::create() {
+    created = true;
+}
+
+void NullIndexBuffer::destroy() {
+    created = false;
+    indexCount = 0;
+}
+
+void NullIndexBuffer::upload(const uint32_t* data, size_t count, BufferUsage /*usage*/) {
+    indexCount = count;
+    if (data) {
+        counters.bytesUploaded += count * sizeof(uint32_t);
+    }
+}
+
+void NullIndexBuffer::bind() {
+    counters.stateChanges++;
+}
+
+void NullIndexBuffer::unbind() {
+    counters.stateChanges++;
+}
+
+// NullTexture implementation
+
+NullTexture::NullTexture(NullRenderDevice::Counters& counters, RenderStateCache& stateCache, uint32_t name)
+    : counters(counters), stateCache(stateCache), name(name), created(false) {}
+
+void NullTexture::create() {
+    created = true;
+}
+
+void NullTexture::destroy() {
+    if (created) {
+        stateCache.forgetTexture(name);
+    }
+    created = false;
+}
+
+void NullTexture::upload(int width, int height, const uint8_t* rgba, bool /*generateMipmaps*/) {
+    this->width = width;
+    this->height = height;
+    bindForEdit();
+    if (rgba) {
+        counters.bytesUploaded += static_cast<uint64_t>(width) * height * 4;
+    }
+}
+
+void NullTexture::setFilter(TextureFilter /*min*/, TextureFilter /*mag*/) {
+    bindForEdit();
+    counters.stateChanges++;
+}
+
+void NullTexture::setWrap(TextureWrap /*s*/, TextureWrap /*t*/) {
+    bindForEdit();
+    counters.stateChanges++;
+}
+
+void NullTexture::bind(int unit) {
+    counters.countState(stateCache.bindTexture(unit, name));
+}
+
+void NullTexture::unbind(int unit) {
+    counters.countState(stateCache.bindTexture(unit, 0));
+}
+
+void NullTexture::bindForEdit() {
+    // As GLTexture: edits bind to the active unit
+    int unit = stateCache.getActiveTexture();
+    stateCache.setActiveTexture(unit);
+    counters.countState(stateCache.bindTexture(unit, name));
+}
+
+} // namespace mc
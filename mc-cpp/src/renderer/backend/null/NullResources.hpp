@@ -0,0 +1,107 @@
+#pragma once
+
+#include "renderer/backend/ShaderPipeline.hpp"
+#include "renderer/backend/VertexBuffer.hpp"
+#include "renderer/backend/Texture.hpp"
+#include "NullRenderDevice.hpp"
+#include <unordered_map>
+
+namespace mc {
+
+// Resources of the null backend. Each reports into its device's counters.
+
+class NullShaderPipeline : public ShaderPipeline {
+public:
+    NullShaderPipeline(NullRenderDevice::Counters& counters, RenderStateCache& stateCache, uint32_t name);
+    ~NullShaderPipeline() override;
+
+    // Succeeds without reading the files
+    bool loadFromGLSL(const std::string& vertexPath, const std::string& fragmentPath) override;
+    void bind() override;
+    void unbind() override;
+
+    // Any name resolves, to a handle unique to this pipeline
+    UniformHandle getUniform(const std::string& name) override;
+
+    void setInt(UniformHandle uniform, int value) override;
+    void setFloat(UniformHandle uniform, float value) override;
+    void setVec2(UniformHandle uniform, float x, float y) override;
+    void setVec3(UniformHandle uniform, float x, float y, float z) override;
+    void setVec4(UniformHandle uniform, float x, float y, float z, float w) override;
+    void setMat3(UniformHandle uniform, const float* matrix) override;
+    void setMat4(UniformHandle uniform, const float* matrix) override;
+
+    bool isValid() const override { return loaded; }
+
+private:
+    NullRenderDevice::Counters& counters;
+    RenderStateCache& stateCache;
+    uint32_t name;
+    bool loaded;
+    std::unordered_map<std::string, UniformHandle> uniformHandles;
+};
+
+class NullVertexBuffer : public VertexBuffer {
+public:
+    explicit NullVertexBuffer(NullRenderDevice::Counters& counters);
+
+    void create() override;
+    void destroy() override;
+    void upload(const void* data, size_t sizeBytes, BufferUsage usage) override;
+    void uploadRange(const void* data, size_t offsetBytes, size_t sizeBytes) override;
+    void copyFrom(const VertexBuffer& source, size_t sizeBytes) override;
+    size_t stream(const void* data, size_t sizeBytes, size_t alignment) override;
+    void bind() override;
+    void unbind() override;
+    bool isValid() const override { return created; }
+
+    size_t getSize() const { return size; }
+
+private:
+    NullRenderDevice::Counters& counters;
+    size_t size;
+    size_t streamOffset;
+    bool created;
+};
+
+class NullIndexBuffer : public IndexBuffer {
+public:
+    explicit NullIndexBuffer(NullRenderDevice::Counters& counters);
+
+    void create() override;
+    void destroy() override;
+    void upload(const uint32_t* data, size_t count, BufferUsage usage) override;
+    void bind() override;
+    void unbind() override;
+    size_t getCount() const override { return indexCount; }
+    bool isValid() const override { return created; }
+
+private:
+    NullRenderDevice::Counters& counters;
+    size_t indexCount;
+    bool created;
+};
+
+class NullTexture : public Texture {
+public:
+    NullTexture(NullRenderDevice::Counters& counters, RenderStateCache& stateCache, uint32_t name);
+
+    void create() override;
+    void destroy() override;
+    void upload(int width, int height, const uint8_t* rgba, bool generateMipmaps) override;
+    void setFilter(TextureFilter min, TextureFilter mag) override;
+    void setWrap(TextureWrap s, TextureWrap t) override;
+    void bind(int unit) override;
+    void unbind(int unit) override;
+    bool isValid() const override { return created; }
+
+private:
+    void bindForEdit();
+
+    NullRenderDevice::Counters& counters;
+    RenderStateCache& stateCache;
+    uint32_t name;
+    bool created;
+};
+
+} // namespace mc
@@ -12,6 +12,11 @@ void GLRenderContext::configureWindowHints() {
     // macOS requires forward compatibility flag
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
+
+    // Offscreen frames go to the device's FBO; the window only holds the context
+    if (offscreen) {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    }
 }
 
 bool GLRenderContext::init(GLFWwindow* window) {
@@ -53,7 +58,7 @@ void GLRenderContext::handleResize(int width, int height) {
 }
 
 void GLRenderContext::swapBuffers() {
-    if (window) {
+    if (window && !offscreen) {
         glfwSwapBuffers(window);
     }
 }
@@ -17,10 +17,12 @@ public:
     void setVsync(bool enabled) override;
     void handleResize(int width, int height) override;
     void swapBuffers() override;
+    void setOffscreen(bool enabled) override { offscreen = enabled; }
     GLFWwindow* getWindow() const override { return window; }
 
 private:
     GLFWwindow* window = nullptr;
+    bool offscreen = false;  // Hidden window, nothing to swap
 };
 
 } // namespace mc
@@ -3,8 +3,13 @@
 #include "GLVertexBuffer.hpp"
 #include "GLTexture.hpp"
 #include "renderer/backend/RenderTypes.hpp"
+#include "util/PngWriter.hpp"
+#include <algorithm>
 #include <iostream>
 #include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <vector>
 
 namespace mc {
 
@@ -33,16 +38,40 @@ bool GLRenderDevice::init(void* windowHandle) {
     // Detect OpenGL version
     detectGLVersion();
 
+    // A new context starts from defaults the cache doesn't assume
+    stateCache.invalidate();
+
     initialized = true;
     return true;
 }
 
 void GLRenderDevice::shutdown() {
+    releaseQuadIndexBuffer();
+    if (initialized) {
+        collectCaptures(true);
+        destroyOffscreen();
+    }
+    if (textureFBO != 0) {
+        glDeleteFramebuffers(1, &textureFBO);
+        glDeleteRenderbuffers(1, &textureDepth);
+        textureFBO = textureDepth = 0;
+        textureDepthWidth = textureDepthHeight = 0;
+    }
+    if (frameUniformBuffer != 0) {
+        glDeleteBuffers(1, &frameUniformBuffer);
+        frameUniformBuffer = 0;
+    }
+    if (indirectBuffer != 0) {
+        glDeleteBuffers(1, &indirectBuffer);
+        indirectBuffer = 0;
+    }
     initialized = false;
 }
 
 void GLRenderDevice::beginFrame() {
-    // OpenGL doesn't need explicit frame begin
+    if (offscreenFBO != 0) {
+        glBindFramebuffer(GL_FRAMEBUFFER, offscreenFBO);
+    }
 }
 
 void GLRenderDevice::endFrame() {
@@ -51,6 +80,208 @@ void GLRenderDevice::endFrame() {
 
 void GLRenderDevice::present() {
     // Swap buffers is handled by GLFW in the main loop
+    if (offscreenFBO == 0 || captureInterval <= 0) return;
+
+    collectCaptures(false);
+    if (presentedFrames % static_cast<uint64_t>(captureInterval) == 0) {
+        queueCapture();
+    }
+    presentedFrames++;
+}
+
+bool GLRenderDevice::setOffscreen(int width, int height) {
+    if (width <= 0 || height <= 0) return false;
+
+    // Readbacks of the old size still in flight finish against their own PBOs
+    if (offscreenFBO == 0) {
+        glGenFramebuffers(1, &offscreenFBO);
+        glGenRenderbuffers(1, &offscreenColor);
+        glGenRenderbuffers(1, &offscreenDepth);
+    }
+
+    glBindRenderbuffer(GL_RENDERBUFFER, offscreenColor);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, offscreenDepth);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, offscreenFBO);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, offscreenColor);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, offscreenDepth);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "Offscreen framebuffer incomplete" << std::endl;
+        destroyOffscreen();
+        return false;
+    }
+
+    offscreenWidth = width;
+    offscreenHeight = height;
+    return true;
+}
+
+bool GLRenderDevice::beginRenderToTexture(Texture* texture) {
+    auto* glTexture = static_cast<GLTexture*>(texture);
+    if (!glTexture || !glTexture->isValid()) return false;
+    int width = texture->getWidth();
+    int height = texture->getHeight();
+    if (width <= 0 || height <= 0) return false;
+
+    if (textureFBO == 0) {
+        glGenFramebuffers(1, &textureFBO);
+        glGenRenderbuffers(1, &textureDepth);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, textureFBO);
+
+    // The depth buffer may be larger than the texture; only the viewport's
+    // corner of it is used
+    if (width > textureDepthWidth || height > textureDepthHeight) {
+        textureDepthWidth = std::max(width, textureDepthWidth);
+        textureDepthHeight = std::max(height, textureDepthHeight);
+        glBindRenderbuffer(GL_RENDERBUFFER, textureDepth);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, textureDepthWidth, textureDepthHeight);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, textureDepth);
+    }
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, glTexture->getTextureId(), 0);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "Render-to-texture framebuffer incomplete" << std::endl;
+        glBindFramebuffer(GL_FRAMEBUFFER, offscreenFBO);
+        return false;
+    }
+
+    glGetIntegerv(GL_VIEWPORT, savedViewport);
+    glViewport(0, 0, width, height);
+    return true;
+}
+
+void GLRenderDevice::endRenderToTexture() {
+    // Detach so the texture can't be sampled while still attached
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, offscreenFBO);  // 0 = the window
+    glViewport(savedViewport[0], savedViewport[1], savedViewport[2], savedViewport[3]);
+}
+
+void GLRenderDevice::setFrameCapture(int interval, const std::string& directory) {
+    captureInterval = interval;
+    captureDirectory = directory.empty() ? "." : directory;
+    presentedFrames = 0;
+
+    if (captureInterval > 0) {
+        std::error_code error;
+        std::filesystem::create_directories(captureDirectory, error);
+    }
+}
+
+void GLRenderDevice::destroyOffscreen() {
+    for (Capture& capture : captures) {
+        if (capture.fence) {
+            glDeleteSync(capture.fence);
+            capture.fence = nullptr;
+        }
+        if (capture.pbo != 0) {
+            glDeleteBuffers(1, &capture.pbo);
+            capture.pbo = 0;
+            capture.size = 0;
+        }
+    }
+
+    if (offscreenFBO != 0) {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &offscreenFBO);
+        glDeleteRenderbuffers(1, &offscreenColor);
+        glDeleteRenderbuffers(1, &offscreenDepth);
+        offscreenFBO = offscreenColor = offscreenDepth = 0;
+    }
+    offscreenWidth = offscreenHeight = 0;
+}
+
+void GLRenderDevice::queueCapture() {
+    Capture* slot = nullptr;
+    for (Capture& capture : captures) {
+        if (!capture.fence) {
+            slot = &capture;
+            break;
+        }
+    }
+
+    // Every slot still in flight: wait for them rather than skip the frame
+    if (!slot) {
+        collectCaptures(true);
+        slot = &captures[0];
+    }
+
+    size_t size = static_cast<size_t>(offscreenWidth) * offscreenHeight * 4;
+    if (slot->pbo == 0) {
+        glGenBuffers(1, &slot->pbo);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->pbo);
+    if (slot->size != size) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_READ);
+        slot->size = size;
+    }
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, offscreenFBO);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, offscreenWidth, offscreenHeight, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot->width = offscreenWidth;
+    slot->height = offscreenHeight;
+    slot->frame = presentedFrames;
+}
+
+void GLRenderDevice::collectCaptures(bool wait) {
+    while (true) {
+        // Oldest readback in flight
+        Capture* capture = nullptr;
+        for (Capture& candidate : captures) {
+            if (candidate.fence && (!capture || candidate.frame < capture->frame)) {
+                capture = &candidate;
+            }
+        }
+        if (!capture) return;
+
+        GLenum status = glClientWaitSync(capture->fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+                                         wait ? 1000000000ull : 0);
+        bool done = status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+        if (!done && !wait) return;  // Not finished yet, try again next frame
+
+        glDeleteSync(capture->fence);
+        capture->fence = nullptr;
+        if (!done) continue;  // Timed out or failed: drop this frame
+
+        // GL rows run bottom-up, PNG rows top-down
+        std::vector<uint8_t> pixels(capture->size);
+        size_t rowBytes = static_cast<size_t>(capture->width) * 4;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, capture->pbo);
+        const auto* mapped = static_cast<const uint8_t*>(
+            glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(capture->size), GL_MAP_READ_BIT));
+        if (mapped) {
+            for (int y = 0; y < capture->height; y++) {
+                std::memcpy(pixels.data() + rowBytes * y,
+                            mapped + rowBytes * (capture->height - 1 - y), rowBytes);
+            }
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+            // Blending leaves destination alpha below 1 (clouds, water), but
+            // the screen is opaque, so the capture must be too
+            for (size_t i = 3; i < pixels.size(); i += 4) {
+                pixels[i] = 255;
+            }
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        if (!mapped) continue;
+
+        char name[32];
+        std::snprintf(name, sizeof(name), "frame_%06llu.png", static_cast<unsigned long long>(capture->frame));
+        std::string path = captureDirectory + "/" + name;
+        if (!PngWriter::write(path, capture->width, capture->height, pixels.data())) {
+            std::cerr << "Failed to write frame capture " << path << std::endl;
+        }
+    }
 }
 
 void GLRenderDevice::setViewport(int x, int y, int width, int height) {
@@ -68,68 +299,91 @@ void GLRenderDevice::clear(bool color, bool depth) {
     glClear(mask);
 }
 
-void GLRenderDevice::setDepthTest(bool enabled) {
+void GLRenderDevice::setCapability(RenderStateCache::Capability cap, GLenum glCap, bool enabled) {
+    if (!stateCache.setEnabled(cap, enabled)) return;
     if (enabled) {
-        glEnable(GL_DEPTH_TEST);
+        glEnable(glCap);
     } else {
-        glDisable(GL_DEPTH_TEST);
+        glDisable(glCap);
     }
 }
 
+void GLRenderDevice::setDepthTest(bool enabled) {
+    setCapability(RenderStateCache::Capability::DepthTest, GL_DEPTH_TEST, enabled);
+}
+
 void GLRenderDevice::setDepthWrite(bool enabled) {
-    glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+    if (stateCache.setDepthWrite(enabled)) {
+        glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+    }
 }
 
 void GLRenderDevice::setDepthFunc(CompareFunc func) {
-    glDepthFunc(toGLCompareFunc(func));
+    if (stateCache.setDepthFunc(func)) {
+        glDepthFunc(toGLCompareFunc(func));
+    }
 }
 
 void GLRenderDevice::setCullFace(bool enabled, CullMode mode) {
-    if (enabled) {
-        glEnable(GL_CULL_FACE);
-        switch (mode) {
-            case CullMode::Back: glCullFace(GL_BACK); break;
-            case CullMode::Front: glCullFace(GL_FRONT); break;
-            case CullMode::None: glDisable(GL_CULL_FACE); break;
-        }
-    } else {
-        glDisable(GL_CULL_FACE);
+    if (!enabled || mode == CullMode::None) {
+        setCapability(RenderStateCache::Capability::CullFace, GL_CULL_FACE, false);
+        return;
+    }
+    setCapability(RenderStateCache::Capability::CullFace, GL_CULL_FACE, true);
+    if (stateCache.setCullMode(mode)) {
+        glCullFace(mode == CullMode::Front ? GL_FRONT : GL_BACK);
     }
 }
 
 void GLRenderDevice::setFrontFace(FrontFace face) {
-    glFrontFace(face == FrontFace::CounterClockwise ? GL_CCW : GL_CW);
+    if (stateCache.setFrontFace(face)) {
+        glFrontFace(face == FrontFace::CounterClockwise ? GL_CCW : GL_CW);
+    }
 }
 
 void GLRenderDevice::setBlend(bool enabled, BlendFactor src, BlendFactor dst) {
-    if (enabled) {
-        glEnable(GL_BLEND);
+    setCapability(RenderStateCache::Capability::Blend, GL_BLEND, enabled);
+    if (enabled && stateCache.setBlendFunc(src, dst)) {
         glBlendFunc(toGLBlendFactor(src), toGLBlendFactor(dst));
-    } else {
-        glDisable(GL_BLEND);
     }
 }
 
 void GLRenderDevice::setPolygonOffset(bool enabled, float factor, float units) {
-    if (enabled) {
-        glEnable(GL_POLYGON_OFFSET_FILL);
+    setCapability(RenderStateCache::Capability::PolygonOffset, GL_POLYGON_OFFSET_FILL, enabled);
+    if (enabled && stateCache.setPolygonOffset(factor, units)) {
         glPolygonOffset(factor, units);
-    } else {
-        glDisable(GL_POLYGON_OFFSET_FILL);
     }
 }
 
 void GLRenderDevice::setLineWidth(float width) {
-    glLineWidth(width);
+    if (stateCache.setLineWidth(width)) {
+        glLineWidth(width);
+    }
 }
 
 void GLRenderDevice::setColorMask(bool r, bool g, bool b, bool a) {
-    glColorMask(r ? GL_TRUE : GL_FALSE, g ? GL_TRUE : GL_FALSE,
-                b ? GL_TRUE : GL_FALSE, a ? GL_TRUE : GL_FALSE);
+    if (stateCache.setColorMask(r, g, b, a)) {
+        glColorMask(r ? GL_TRUE : GL_FALSE, g ? GL_TRUE : GL_FALSE,
+                    b ? GL_TRUE : GL_FALSE, a ? GL_TRUE : GL_FALSE);
+    }
+}
+
+void GLRenderDevice::setFrameUniforms(const FrameUniforms& uniforms) {
+    // One buffer for every program: each links its block to the binding
+    if (frameUniformBuffer == 0) {
+        glGenBuffers(1, &frameUniformBuffer);
+        glBindBuffer(GL_UNIFORM_BUFFER, frameUniformBuffer);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameUniforms), &uniforms, GL_DYNAMIC_DRAW);
+        glBindBufferBase(GL_UNIFORM_BUFFER, FrameUniforms::BINDING, frameUniformBuffer);
+    } else {
+        glBindBuffer(GL_UNIFORM_BUFFER, frameUniformBuffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameUniforms), &uniforms);
+    }
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
 }
 
 std::unique_ptr<ShaderPipeline> GLRenderDevice::createShaderPipeline() {
-    return std::make_unique<GLShaderPipeline>();
+    return std::make_unique<GLShaderPipeline>(stateCache);
 }
 
 std::unique_ptr<VertexBuffer> GLRenderDevice::createVertexBuffer() {
@@ -145,7 +399,7 @@ std::unique_ptr<IndexBuffer> GLRenderDevice::createIndexBuffer() {
 }
 
 std::unique_ptr<Texture> GLRenderDevice::createTexture() {
-    auto texture = std::make_unique<GLTexture>();
+    auto texture = std::make_unique<GLTexture>(stateCache);
     texture->create();
     return texture;
 }
@@ -159,7 +413,58 @@ void GLRenderDevice::drawIndexed(PrimitiveType primitive, size_t indexCount, siz
                    reinterpret_cast<void*>(startIndex * sizeof(uint32_t)));
 }
 
+void GLRenderDevice::multiDrawIndexed(PrimitiveType primitive, const DrawIndexedCommand* commands,
+                                      size_t count) {
+    if (count == 0) return;
+    GLenum mode = toGLPrimitive(primitive);
+
+    // Lone draws without per-draw data (Tesselator, particles) skip the
+    // indirect upload
+    if (count == 1 && chunkDrawDataVBO == 0 && commands[0].baseInstance == 0) {
+        glDrawElementsInstancedBaseVertex(mode, static_cast<GLsizei>(commands[0].indexCount), GL_UNSIGNED_INT,
+                                          reinterpret_cast<void*>(commands[0].firstIndex * sizeof(uint32_t)),
+                                          static_cast<GLsizei>(commands[0].instanceCount),
+                                          commands[0].baseVertex);
+        return;
+    }
+
+    if (multiDrawIndirect) {
+        if (indirectBuffer == 0) {
+            glGenBuffers(1, &indirectBuffer);
+        }
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, count * sizeof(DrawIndexedCommand), commands, GL_STREAM_DRAW);
+        glMultiDrawElementsIndirect(mode, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(count), 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        return;
+    }
+
+    // GL 3.3: no base instance, so point the origin or model instance
+    // attributes at each draw's entry before drawing it
+    if (chunkDrawDataVBO != 0) {
+        glBindBuffer(GL_ARRAY_BUFFER, chunkDrawDataVBO);
+    } else if (modelInstanceVBO != 0) {
+        glBindBuffer(GL_ARRAY_BUFFER, modelInstanceVBO);
+    }
+    for (size_t i = 0; i < count; i++) {
+        const DrawIndexedCommand& cmd = commands[i];
+        if (chunkDrawDataVBO != 0) {
+            glVertexAttribPointer(ChunkVertexFormat::ATTRIB_ORIGIN, 3, GL_FLOAT, GL_FALSE,
+                                  ChunkVertexFormat::DRAW_DATA_STRIDE,
+                                  reinterpret_cast<void*>(cmd.baseInstance * ChunkVertexFormat::DRAW_DATA_STRIDE));
+        } else if (modelInstanceVBO != 0) {
+            pointModelInstanceAttributes(cmd.baseInstance * ModelVertexFormat::INSTANCE_STRIDE);
+        }
+        glDrawElementsInstancedBaseVertex(mode, static_cast<GLsizei>(cmd.indexCount), GL_UNSIGNED_INT,
+                                          reinterpret_cast<void*>(cmd.firstIndex * sizeof(uint32_t)),
+                                          static_cast<GLsizei>(cmd.instanceCount), cmd.baseVertex);
+    }
+}
+
 void GLRenderDevice::setupVertexAttributes() {
+    chunkDrawDataVBO = 0;
+    modelInstanceVBO = 0;
+
     // Position: 3 floats at offset 0
     glEnableVertexAttribArray(VertexFormat::ATTRIB_POSITION);
     glVertexAttribPointer(VertexFormat::ATTRIB_POSITION, 3, GL_FLOAT, GL_FALSE,
@@ -180,12 +485,86 @@ void GLRenderDevice::setupVertexAttributes() {
     glVertexAttribPointer(VertexFormat::ATTRIB_NORMAL, 3, GL_BYTE, GL_TRUE,
                          VertexFormat::STRIDE, reinterpret_cast<void*>(24));
 
-    // Light: 2 bytes at offset 28
+    // Light: 4 bytes at offset 28 (sky, block, atlas tile, repeat flag)
     glEnableVertexAttribArray(VertexFormat::ATTRIB_LIGHT);
-    glVertexAttribPointer(VertexFormat::ATTRIB_LIGHT, 2, GL_UNSIGNED_BYTE, GL_FALSE,
+    glVertexAttribPointer(VertexFormat::ATTRIB_LIGHT, 4, GL_UNSIGNED_BYTE, GL_FALSE,
                          VertexFormat::STRIDE, reinterpret_cast<void*>(28));
 }
 
+void GLRenderDevice::setupChunkVertexAttributes(VertexBuffer* drawData) {
+    // Packed chunk vertex: 3 uints at offset 0, read as integers and decoded
+    // in chunk.vert. Chunk buffers never use the other attributes.
+    glEnableVertexAttribArray(ChunkVertexFormat::ATTRIB_PACKED);
+    glVertexAttribIPointer(ChunkVertexFormat::ATTRIB_PACKED, 3, GL_UNSIGNED_INT,
+                           ChunkVertexFormat::STRIDE, reinterpret_cast<void*>(0));
+
+    // Chunk origin: 3 floats per instance from the draw-data buffer. Binding
+    // it directly keeps the chunk buffer's VAO bound.
+    modelInstanceVBO = 0;
+    chunkDrawDataVBO = drawData ? static_cast<GLVertexBuffer*>(drawData)->getVBO() : 0;
+    if (chunkDrawDataVBO != 0) {
+        glBindBuffer(GL_ARRAY_BUFFER, chunkDrawDataVBO);
+        glEnableVertexAttribArray(ChunkVertexFormat::ATTRIB_ORIGIN);
+        glVertexAttribPointer(ChunkVertexFormat::ATTRIB_ORIGIN, 3, GL_FLOAT, GL_FALSE,
+                              ChunkVertexFormat::DRAW_DATA_STRIDE, reinterpret_cast<void*>(0));
+        glVertexAttribDivisor(ChunkVertexFormat::ATTRIB_ORIGIN, 1);
+    }
+}
+
+void GLRenderDevice::setupParticleVertexAttributes(VertexBuffer* instances) {
+    chunkDrawDataVBO = 0;
+    modelInstanceVBO = 0;
+
+    // Quad corner: 2 floats per vertex from the bound buffer
+    glEnableVertexAttribArray(ParticleVertexFormat::ATTRIB_CORNER);
+    glVertexAttribPointer(ParticleVertexFormat::ATTRIB_CORNER, 2, GL_FLOAT, GL_FALSE,
+                          ParticleVertexFormat::CORNER_STRIDE, reinterpret_cast<void*>(0));
+
+    // Particle: position and half size, color, tile, stepped per instance
+    glBindBuffer(GL_ARRAY_BUFFER, static_cast<GLVertexBuffer*>(instances)->getVBO());
+    glEnableVertexAttribArray(ParticleVertexFormat::ATTRIB_POSITION_SIZE);
+    glVertexAttribPointer(ParticleVertexFormat::ATTRIB_POSITION_SIZE, 4, GL_FLOAT, GL_FALSE,
+                          ParticleVertexFormat::INSTANCE_STRIDE, reinterpret_cast<void*>(0));
+    glVertexAttribDivisor(ParticleVertexFormat::ATTRIB_POSITION_SIZE, 1);
+    glEnableVertexAttribArray(ParticleVertexFormat::ATTRIB_COLOR);
+    glVertexAttribPointer(ParticleVertexFormat::ATTRIB_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE,
+                          ParticleVertexFormat::INSTANCE_STRIDE, reinterpret_cast<void*>(16));
+    glVertexAttribDivisor(ParticleVertexFormat::ATTRIB_COLOR, 1);
+    glEnableVertexAttribArray(ParticleVertexFormat::ATTRIB_TILE);
+    glVertexAttribPointer(ParticleVertexFormat::ATTRIB_TILE, 1, GL_FLOAT, GL_FALSE,
+                          ParticleVertexFormat::INSTANCE_STRIDE, reinterpret_cast<void*>(20));
+    glVertexAttribDivisor(ParticleVertexFormat::ATTRIB_TILE, 1);
+}
+
+void GLRenderDevice::setupModelVertexAttributes(VertexBuffer* instances) {
+    // Compiled part cubes use the standard format
+    setupVertexAttributes();
+
+    // Part: model matrix columns, color and light, stepped per instance
+    modelInstanceVBO = static_cast<GLVertexBuffer*>(instances)->getVBO();
+    glBindBuffer(GL_ARRAY_BUFFER, modelInstanceVBO);
+    for (int column = 0; column < 4; column++) {
+        glEnableVertexAttribArray(ModelVertexFormat::ATTRIB_TRANSFORM + column);
+        glVertexAttribDivisor(ModelVertexFormat::ATTRIB_TRANSFORM + column, 1);
+    }
+    glEnableVertexAttribArray(ModelVertexFormat::ATTRIB_COLOR);
+    glVertexAttribDivisor(ModelVertexFormat::ATTRIB_COLOR, 1);
+    glEnableVertexAttribArray(ModelVertexFormat::ATTRIB_LIGHT);
+    glVertexAttribDivisor(ModelVertexFormat::ATTRIB_LIGHT, 1);
+    pointModelInstanceAttributes(0);
+}
+
+void GLRenderDevice::pointModelInstanceAttributes(size_t offset) {
+    for (int column = 0; column < 4; column++) {
+        glVertexAttribPointer(ModelVertexFormat::ATTRIB_TRANSFORM + column, 4, GL_FLOAT, GL_FALSE,
+                              ModelVertexFormat::INSTANCE_STRIDE, reinterpret_cast<void*>(offset + column * 16));
+    }
+    glVertexAttribPointer(ModelVertexFormat::ATTRIB_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE,
+                          ModelVertexFormat::INSTANCE_STRIDE, reinterpret_cast<void*>(offset + 64));
+    glVertexAttribPointer(ModelVertexFormat::ATTRIB_LIGHT, 4, GL_UNSIGNED_BYTE, GL_FALSE,
+                          ModelVertexFormat::INSTANCE_STRIDE, reinterpret_cast<void*>(offset + 68));
+}
+
 GLenum GLRenderDevice::toGLPrimitive(PrimitiveType prim) {
     switch (prim) {
         case PrimitiveType::Triangles: return GL_TRIANGLES;
@@ -246,6 +625,13 @@ void GLRenderDevice::detectGLVersion() {
     }
 
     std::cout << "OpenGL Version: " << glVersionMajor << "." << glVersionMinor << std::endl;
+
+    bool gl43 = glVersionMajor > 4 || (glVersionMajor == 4 && glVersionMinor >= 3);
+    multiDrawIndirect = glMultiDrawElementsIndirect != nullptr &&
+                        (gl43 || (GLEW_ARB_multi_draw_indirect && GLEW_ARB_base_instance));
+    if (!multiDrawIndirect) {
+        std::cout << "Multi-draw indirect unavailable, drawing chunks one call at a time" << std::endl;
+    }
     if (supportsGLSL450()) {
         std::cout << "Using GLSL 450 shaders (native support)" << std::endl;
     } else {
@@ -2,6 +2,8 @@
 
 #include "renderer/backend/RenderDevice.hpp"
 #include <GL/glew.h>
+#include <string>
+#include <cstdint>
 
 namespace mc {
 
@@ -45,6 +47,7 @@ public:
 
     // Color mask
     void setColorMask(bool r, bool g, bool b, bool a) override;
+    void setFrameUniforms(const FrameUniforms& uniforms) override;
 
     // Factory methods
     std::unique_ptr<ShaderPipeline> createShaderPipeline() override;
@@ -55,24 +58,92 @@ public:
     // Draw commands
     void draw(PrimitiveType primitive, size_t vertexCount, size_t startVertex = 0) override;
     void drawIndexed(PrimitiveType primitive, size_t indexCount, size_t startIndex = 0) override;
+    void multiDrawIndexed(PrimitiveType primitive, const DrawIndexedCommand* commands,
+                          size_t count) override;
 
     // Vertex attributes
     void setupVertexAttributes() override;
+    void setupChunkVertexAttributes(VertexBuffer* drawData) override;
+    void setupParticleVertexAttributes(VertexBuffer* instances) override;
+    void setupModelVertexAttributes(VertexBuffer* instances) override;
+
+    // Offscreen rendering into an FBO, with PBO frame capture
+    bool setOffscreen(int width, int height) override;
+    void setFrameCapture(int interval, const std::string& directory) override;
+
+    // Texture targets share one FBO and a depth renderbuffer sized to the
+    // largest texture so far
+    bool beginRenderToTexture(Texture* texture) override;
+    void endRenderToTexture() override;
 
     // Version querying
     int getMajorVersion() const { return glVersionMajor; }
     int getMinorVersion() const { return glVersionMinor; }
     bool supportsGLSL450() const { return (glVersionMajor > 4) || (glVersionMajor == 4 && glVersionMinor >= 5); }
+    bool supportsMultiDrawIndirect() const { return multiDrawIndirect; }
 
 private:
     static GLenum toGLPrimitive(PrimitiveType prim);
     static GLenum toGLCompareFunc(CompareFunc func);
     static GLenum toGLBlendFactor(BlendFactor factor);
+    // glEnable/glDisable through the state cache
+    void setCapability(RenderStateCache::Capability cap, GLenum glCap, bool enabled);
     void detectGLVersion();
+    // Point the model instance attributes at the bound buffer, from offset
+    static void pointModelInstanceAttributes(size_t offset);
+
+    void destroyOffscreen();
+    void queueCapture();
+    // Write out finished readbacks, oldest first; with wait, block until all are done
+    void collectCaptures(bool wait);
 
     bool initialized;
     int glVersionMajor = 0;
     int glVersionMinor = 0;
+
+    // glMultiDrawElementsIndirect with base instances (GL 4.3 or the ARB extensions)
+    bool multiDrawIndirect = false;
+    GLuint indirectBuffer = 0;
+
+    // FrameUniforms block, bound at FrameUniforms::BINDING once created
+    GLuint frameUniformBuffer = 0;
+
+    // Draw-data buffer from the last setupChunkVertexAttributes, for the
+    // per-draw fallback to re-point the origin attribute (0 = none)
+    GLuint chunkDrawDataVBO = 0;
+
+    // Instance buffer from the last setupModelVertexAttributes, re-pointed
+    // the same way (0 = none)
+    GLuint modelInstanceVBO = 0;
+
+    // Offscreen target (0 = render to the window)
+    GLuint offscreenFBO = 0;
+    GLuint offscreenColor = 0;  // RGBA8 renderbuffer
+    GLuint offscreenDepth = 0;  // Depth renderbuffer
+    int offscreenWidth = 0;
+    int offscreenHeight = 0;
+
+    // Render-to-texture target (0 = not created yet)
+    GLuint textureFBO = 0;
+    GLuint textureDepth = 0;
+    int textureDepthWidth = 0;
+    int textureDepthHeight = 0;
+    GLint savedViewport[4] = {0, 0, 0, 0};
+
+    // Frame capture: glReadPixels into a pixel pack buffer returns at once;
+    // the pixels are mapped a few frames later, once the fence has passed
+    static constexpr int CAPTURE_SLOTS = 3;
+    struct Capture {
+        GLuint pbo = 0;
+        GLsync fence = nullptr;  // Null when the slot is free
+        size_t size = 0;         // PBO size in bytes
+        int width = 0, height = 0;
+        uint64_t frame = 0;
+    };
+    Capture captures[CAPTURE_SLOTS];
+    int captureInterval = 0;
+    std::string captureDirectory;
+    uint64_t presentedFrames = 0;
 };
 
 } // namespace mc
@@ -2,17 +2,19 @@
 #include "GLRenderDevice.hpp"
 #include "renderer/backend/RenderDevice.hpp"
 #include "renderer/GLSLTranspiler.hpp"
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 
 namespace mc {
 
-GLShaderPipeline::GLShaderPipeline() : program(0) {}
+GLShaderPipeline::GLShaderPipeline(RenderStateCache& stateCache) : stateCache(stateCache), program(0) {}
 
 GLShaderPipeline::~GLShaderPipeline() {
     if (program) {
         glDeleteProgram(program);
+        stateCache.forgetProgram(program);
     }
 }
 
@@ -48,7 +50,8 @@ bool GLShaderPipeline::loadFromGLSL(const std::string& vertexPath, const std::st
         transpiledFragment = GLSLTranspiler::transpile450to330(fragmentSource);
     } else {
         // Even on OGL 4.5+, we need to extract uniform blocks to individual uniforms
-        // because the C++ code uses glGetUniformLocation() which doesn't work with block members
+        // because the C++ code uses glGetUniformLocation() which doesn't work with block
+        // members (FrameUniforms stays a block, filled by RenderDevice::setFrameUniforms)
         transpiledVertex = GLSLTranspiler::extractUniformBlocks(vertexSource);
         transpiledFragment = GLSLTranspiler::extractUniformBlocks(fragmentSource);
     }
@@ -86,9 +89,37 @@ bool GLShaderPipeline::loadFromGLSL(const std::string& vertexPath, const std::st
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
+    resolveUniforms();
     return program != 0;
 }
 
+void GLShaderPipeline::resolveUniforms() {
+    uniforms.clear();
+    uniformHandles.clear();
+
+    GLint count = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+    for (GLint i = 0; i < count; i++) {
+        char name[128];
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(program, static_cast<GLuint>(i), sizeof(name), &length, &size, &type, name);
+
+        // Block members have no location; they are set through the buffer
+        GLint location = glGetUniformLocation(program, name);
+        if (location < 0) continue;
+
+        uniformHandles[std::string(name, length)] = static_cast<UniformHandle>(uniforms.size());
+        uniforms.push_back({location, false, {}});
+    }
+
+    GLuint frameBlock = glGetUniformBlockIndex(program, "FrameUniforms");
+    if (frameBlock != GL_INVALID_INDEX) {
+        glUniformBlockBinding(program, frameBlock, FrameUniforms::BINDING);
+    }
+}
+
 GLuint GLShaderPipeline::compileShader(GLenum type, const std::string& source) {
     GLuint shader = glCreateShader(type);
     const char* src = source.c_str();
@@ -111,50 +142,76 @@ GLuint GLShaderPipeline::compileShader(GLenum type, const std::string& source) {
 }
 
 void GLShaderPipeline::bind() {
-    glUseProgram(program);
+    if (stateCache.useProgram(program)) {
+        glUseProgram(program);
+    }
 }
 
 void GLShaderPipeline::unbind() {
-    glUseProgram(0);
+    if (stateCache.useProgram(0)) {
+        glUseProgram(0);
+    }
 }
 
-GLint GLShaderPipeline::getUniformLocation(const std::string& name) {
-    auto it = uniformLocations.find(name);
-    if (it != uniformLocations.end()) {
-        return it->second;
-    }
+UniformHandle GLShaderPipeline::getUniform(const std::string& name) {
+    auto it = uniformHandles.find(name);
+    return it != uniformHandles.end() ? it->second : -1;
+}
 
-    GLint location = glGetUniformLocation(program, name.c_str());
-    uniformLocations[name] = location;
-    return location;
+bool GLShaderPipeline::update(UniformHandle uniform, const void* data, size_t size) {
+    if (uniform < 0) return false;
+
+    // Uniform values live in the program, so the shadow stays valid across binds
+    Uniform& u = uniforms[uniform];
+    if (u.hasValue && std::memcmp(u.value, data, size) == 0) return false;
+    std::memcpy(u.value, data, size);
+    u.hasValue = true;
+    return true;
 }
 
-void GLShaderPipeline::setInt(const std::string& name, int value) {
-    glUniform1i(getUniformLocation(name), value);
+void GLShaderPipeline::setInt(UniformHandle uniform, int value) {
+    if (update(uniform, &value, sizeof(value))) {
+        glUniform1i(uniforms[uniform].location, value);
+    }
 }
 
-void GLShaderPipeline::setFloat(const std::string& name, float value) {
-    glUniform1f(getUniformLocation(name), value);
+void GLShaderPipeline::setFloat(UniformHandle uniform, float value) {
+    if (update(uniform, &value, sizeof(value))) {
+        glUniform1f(uniforms[uniform].location, value);
+    }
 }
 
-void GLShaderPipeline::setVec2(const std::string& name, float x, float y) {
-    glUniform2f(getUniformLocation(name), x, y);
+void GLShaderPipeline::setVec2(UniformHandle uniform, float x, float y) {
+    float data[2] = {x, y};
+    if (update(uniform, data, sizeof(data))) {
+        glUniform2f(uniforms[uniform].location, x, y);
+    }
 }
 
-void GLShaderPipeline::setVec3(const std::string& name, float x, float y, float z) {
-    glUniform3f(getUniformLocation(name), x, y, z);
+void GLShaderPipeline::setVec3(UniformHandle uniform, float x, float y, float z) {
+    float data[3] = {x, y, z};
+    if (update(uniform, data, sizeof(data))) {
+        glUniform3f(uniforms[uniform].location, x, y, z);
+    }
 }
 
-void GLShaderPipeline::setVec4(const std::string& name, float x, float y, float z, float w) {
-    glUniform4f(getUniformLocation(name), x, y, z, w);
+void GLShaderPipeline::setVec4(UniformHandle uniform, float x, float y, float z, float w) {
+    float data[4] = {x, y, z, w};
+    if (update(uniform, data, sizeof(data))) {
+        glUniform4f(uniforms[uniform].location, x, y, z, w);
+    }
 }
 
-void GLShaderPipeline::setMat3(const std::string& name, const float* matrix) {
-    glUniformMatrix3fv(getUniformLocation(name), 1, GL_FALSE, matrix);
+void GLShaderPipeline::setMat3(UniformHandle uniform, const float* matrix) {
+    if (update(uniform, matrix, 9 * sizeof(float))) {
+        glUniformMatrix3fv(uniforms[uniform].location, 1, GL_FALSE, matrix);
+    }
 }
 
-void GLShaderPipeline::setMat4(const std::string& name, const float* matrix) {
-    glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, matrix);
+void GLShaderPipeline::setMat4(UniformHandle uniform, const float* matrix) {
+    if (update(uniform, matrix, 16 * sizeof(float))) {
+        glUniformMatrix4fv(uniforms[uniform].location, 1, GL_FALSE, matrix);
+    }
 }
 
 } // namespace mc
@@ -1,38 +1,55 @@
 #pragma once
 
 #include "renderer/backend/ShaderPipeline.hpp"
+#include "renderer/backend/RenderStateCache.hpp"
 #include <GL/glew.h>
 #include <unordered_map>
+#include <vector>
 
 namespace mc {
 
 class GLShaderPipeline : public ShaderPipeline {
 public:
-    GLShaderPipeline();
+    explicit GLShaderPipeline(RenderStateCache& stateCache);
     ~GLShaderPipeline() override;
 
     bool loadFromGLSL(const std::string& vertexPath, const std::string& fragmentPath) override;
     void bind() override;
     void unbind() override;
 
-    void setInt(const std::string& name, int value) override;
-    void setFloat(const std::string& name, float value) override;
-    void setVec2(const std::string& name, float x, float y) override;
-    void setVec3(const std::string& name, float x, float y, float z) override;
-    void setVec4(const std::string& name, float x, float y, float z, float w) override;
-    void setMat3(const std::string& name, const float* matrix) override;
-    void setMat4(const std::string& name, const float* matrix) override;
+    UniformHandle getUniform(const std::string& name) override;
+
+    void setInt(UniformHandle uniform, int value) override;
+    void setFloat(UniformHandle uniform, float value) override;
+    void setVec2(UniformHandle uniform, float x, float y) override;
+    void setVec3(UniformHandle uniform, float x, float y, float z) override;
+    void setVec4(UniformHandle uniform, float x, float y, float z, float w) override;
+    void setMat3(UniformHandle uniform, const float* matrix) override;
+    void setMat4(UniformHandle uniform, const float* matrix) override;
 
     bool isValid() const override { return program != 0; }
     GLuint getProgram() const { return program; }
 
 private:
     GLuint compileShader(GLenum type, const std::string& source);
-    GLint getUniformLocation(const std::string& name);
     std::string readFile(const std::string& path);
-
+    // Look up every active uniform and link the FrameUniforms block
+    void resolveUniforms();
+    // Store a new value in the uniform's shadow copy; false if it is invalid
+    // or unchanged, so the GL call can be skipped
+    bool update(UniformHandle uniform, const void* data, size_t size);
+
+    // A resolved uniform and the last value uploaded to it
+    struct Uniform {
+        GLint location;
+        bool hasValue = false;
+        float value[16];
+    };
+
+    RenderStateCache& stateCache;
     GLuint program;
-    std::unordered_map<std::string, GLint> uniformLocations;
+    std::vector<Uniform> uniforms;
+    std::unordered_map<std::string, UniformHandle> uniformHandles;
 };
 
 } // namespace mc
@@ -2,7 +2,7 @@
 
 namespace mc {
 
-GLTexture::GLTexture() : textureId(0) {}
+GLTexture::GLTexture(RenderStateCache& stateCache) : stateCache(stateCache), textureId(0) {}
 
 GLTexture::~GLTexture() {
     destroy();
@@ -17,6 +17,7 @@ void GLTexture::create() {
 void GLTexture::destroy() {
     if (textureId != 0) {
         glDeleteTextures(1, &textureId);
+        stateCache.forgetTexture(textureId);
         textureId = 0;
     }
     width = 0;
@@ -27,7 +28,7 @@ void GLTexture::upload(int w, int h, const uint8_t* rgba, bool generateMipmaps)
     width = w;
     height = h;
 
-    glBindTexture(GL_TEXTURE_2D, textureId);
+    bindForEdit();
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
 
     if (generateMipmaps) {
@@ -36,25 +37,43 @@ void GLTexture::upload(int w, int h, const uint8_t* rgba, bool generateMipmaps)
 }
 
 void GLTexture::setFilter(TextureFilter min, TextureFilter mag) {
-    glBindTexture(GL_TEXTURE_2D, textureId);
+    bindForEdit();
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, toGLFilter(min));
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, toGLFilter(mag));
 }
 
 void GLTexture::setWrap(TextureWrap s, TextureWrap t) {
-    glBindTexture(GL_TEXTURE_2D, textureId);
+    bindForEdit();
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, toGLWrap(s));
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, toGLWrap(t));
 }
 
 void GLTexture::bind(int unit) {
-    glActiveTexture(GL_TEXTURE0 + unit);
-    glBindTexture(GL_TEXTURE_2D, textureId);
+    if (stateCache.bindTexture(unit, textureId)) {
+        if (stateCache.setActiveTexture(unit)) {
+            glActiveTexture(GL_TEXTURE0 + unit);
+        }
+        glBindTexture(GL_TEXTURE_2D, textureId);
+    }
 }
 
 void GLTexture::unbind(int unit) {
-    glActiveTexture(GL_TEXTURE0 + unit);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    if (stateCache.bindTexture(unit, 0)) {
+        if (stateCache.setActiveTexture(unit)) {
+            glActiveTexture(GL_TEXTURE0 + unit);
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+}
+
+void GLTexture::bindForEdit() {
+    int unit = stateCache.getActiveTexture();
+    if (stateCache.setActiveTexture(unit)) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+    }
+    if (stateCache.bindTexture(unit, textureId)) {
+        glBindTexture(GL_TEXTURE_2D, textureId);
+    }
 }
 
 GLenum GLTexture::toGLFilter(TextureFilter filter) {
@@ -1,13 +1,14 @@
 #pragma once
 
 #include "renderer/backend/Texture.hpp"
+#include "renderer/backend/RenderStateCache.hpp"
 #include <GL/glew.h>
 
 namespace mc {
 
 class GLTexture : public Texture {
 public:
-    GLTexture();
+    explicit GLTexture(RenderStateCache& stateCache);
     ~GLTexture() override;
 
     void create() override;
@@ -24,7 +25,10 @@ public:
 private:
     static GLenum toGLFilter(TextureFilter filter);
     static GLenum toGLWrap(TextureWrap wrap);
+    // Bind to the active unit for upload and parameter changes
+    void bindForEdit();
 
+    RenderStateCache& stateCache;
     GLuint textureId;
 };
 
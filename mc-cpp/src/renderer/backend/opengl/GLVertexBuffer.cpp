@@ -1,5 +1,8 @@
 #include "GLVertexBuffer.hpp"
 #include "renderer/backend/RenderTypes.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
 
 namespace mc {
 
@@ -12,9 +15,12 @@ static GLenum toGLUsage(BufferUsage usage) {
     return GL_STATIC_DRAW;
 }
 
+// Smallest streaming ring; a whole frame of immediate-mode draws fits in a few MB
+static constexpr size_t MIN_STREAM_CAPACITY = 4 * 1024 * 1024;
+
 // GLVertexBuffer implementation
 
-GLVertexBuffer::GLVertexBuffer() : vao(0), vbo(0) {}
+GLVertexBuffer::GLVertexBuffer() : vao(0), vbo(0), streamCapacity(0), streamOffset(0) {}
 
 GLVertexBuffer::~GLVertexBuffer() {
     destroy();
@@ -38,11 +44,60 @@ void GLVertexBuffer::destroy() {
         glDeleteVertexArrays(1, &vao);
         vao = 0;
     }
+    streamCapacity = 0;
+    streamOffset = 0;
 }
 
 void GLVertexBuffer::upload(const void* data, size_t sizeBytes, BufferUsage usage) {
     bind();
     glBufferData(GL_ARRAY_BUFFER, sizeBytes, data, toGLUsage(usage));
+    streamCapacity = 0;  // Storage replaced; the next stream() reallocates
+    streamOffset = 0;
+}
+
+void GLVertexBuffer::uploadRange(const void* data, size_t offsetBytes, size_t sizeBytes) {
+    // The array buffer binding isn't VAO state, so the current VAO is left alone
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(offsetBytes),
+                    static_cast<GLsizeiptr>(sizeBytes), data);
+}
+
+void GLVertexBuffer::copyFrom(const VertexBuffer& source, size_t sizeBytes) {
+    const auto& glSource = static_cast<const GLVertexBuffer&>(source);
+    glBindBuffer(GL_COPY_READ_BUFFER, glSource.vbo);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, vbo);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0,
+                        static_cast<GLsizeiptr>(sizeBytes));
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+size_t GLVertexBuffer::stream(const void* data, size_t sizeBytes, size_t alignment) {
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    size_t offset = (streamOffset + alignment - 1) / alignment * alignment;
+    if (offset + sizeBytes > streamCapacity) {
+        // Orphan: the driver gives back fresh storage at once and frees the
+        // old one when the draws reading it are done
+        streamCapacity = std::max({streamCapacity, std::bit_ceil(sizeBytes), MIN_STREAM_CAPACITY});
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(streamCapacity), nullptr, GL_STREAM_DRAW);
+        offset = 0;
+    }
+
+    // Nothing issued so far reads this range, so the write needs no sync
+    void* mapped = glMapBufferRange(GL_ARRAY_BUFFER, static_cast<GLintptr>(offset),
+                                    static_cast<GLsizeiptr>(sizeBytes),
+                                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (mapped) {
+        std::memcpy(mapped, data, sizeBytes);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    } else {
+        glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(offset),
+                        static_cast<GLsizeiptr>(sizeBytes), data);
+    }
+
+    streamOffset = offset + sizeBytes;
+    return offset;
 }
 
 void GLVertexBuffer::bind() {
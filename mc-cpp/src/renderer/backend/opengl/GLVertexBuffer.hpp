@@ -13,6 +13,9 @@ public:
     void create() override;
     void destroy() override;
     void upload(const void* data, size_t sizeBytes, BufferUsage usage) override;
+    void uploadRange(const void* data, size_t offsetBytes, size_t sizeBytes) override;
+    void copyFrom(const VertexBuffer& source, size_t sizeBytes) override;
+    size_t stream(const void* data, size_t sizeBytes, size_t alignment) override;
     void bind() override;
     void unbind() override;
     bool isValid() const override { return vbo != 0; }
@@ -23,6 +26,10 @@ public:
 private:
     GLuint vao;
     GLuint vbo;
+
+    // Streaming ring state (bytes)
+    size_t streamCapacity;
+    size_t streamOffset;
 };
 
 class GLIndexBuffer : public IndexBuffer {
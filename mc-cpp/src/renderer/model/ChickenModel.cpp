@@ -1,5 +1,4 @@
 #include "renderer/model/ChickenModel.hpp"
-#include "renderer/Tesselator.hpp"
 #include <cmath>
 
 namespace mc {
@@ -15,6 +14,7 @@ ChickenModel::ChickenModel()
     , leg1(26, 0)
     , wing0(24, 13)
     , wing1(24, 13)
+    , batch({&head, &beak, &redThing, &body, &leg0, &leg1, &wing0, &wing1}, 0.0625f)
 {
     // Y offset (chicken sits 16 pixels up in the model space)
     int yo = 16;
@@ -80,34 +80,4 @@ void ChickenModel::setupAnim(float time, float walkSpeed, float bob, float yRot,
     wing1.zRot = -bob;
 }
 
-void ChickenModel::render(Tesselator& t, float scale) {
-    render(t, scale, 1.0f, 1.0f, 1.0f, 1.0f);
-}
-
-void ChickenModel::render(Tesselator& t, float scale, float r, float g, float b, float a) {
-    head.render(t, scale, r, g, b, a);
-    beak.render(t, scale, r, g, b, a);
-    redThing.render(t, scale, r, g, b, a);
-    body.render(t, scale, r, g, b, a);
-    leg0.render(t, scale, r, g, b, a);
-    leg1.render(t, scale, r, g, b, a);
-    wing0.render(t, scale, r, g, b, a);
-    wing1.render(t, scale, r, g, b, a);
-}
-
-void ChickenModel::render(Tesselator& t, float scale, int skyLight, int blockLight) {
-    render(t, scale, 1.0f, 1.0f, 1.0f, 1.0f, skyLight, blockLight);
-}
-
-void ChickenModel::render(Tesselator& t, float scale, float r, float g, float b, float a, int skyLight, int blockLight) {
-    head.render(t, scale, r, g, b, a, skyLight, blockLight);
-    beak.render(t, scale, r, g, b, a, skyLight, blockLight);
-    redThing.render(t, scale, r, g, b, a, skyLight, blockLight);
-    body.render(t, scale, r, g, b, a, skyLight, blockLight);
-    leg0.render(t, scale, r, g, b, a, skyLight, blockLight);
-    leg1.render(t, scale, r, g, b, a, skyLight, blockLight);
-    wing0.render(t, scale, r, g, b, a, skyLight, blockLight);
-    wing1.render(t, scale, r, g, b, a, skyLight, blockLight);
-}
-
 } // namespace mc
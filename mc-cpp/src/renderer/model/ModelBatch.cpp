@@ -0,0 +1,127 @@
+#include "renderer/model/ModelBatch.hpp"
+#include "renderer/model/ModelPart.hpp"
+#include "renderer/Tesselator.hpp"
+#include "renderer/backend/RenderDevice.hpp"
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace mc {
+
+ModelBatch::ModelBatch(std::vector<ModelPart*> parts, float scale)
+    : parts(std::move(parts)), scale(scale)
+{
+}
+
+ModelBatch::~ModelBatch() = default;
+
+void ModelBatch::add(const glm::mat4& transform, float r, float g, float b, float a, int skyLight, int blockLight) {
+    queue(queued, transform, r, g, b, a, skyLight, blockLight);
+}
+
+void ModelBatch::addOverlay(const glm::mat4& transform, float r, float g, float b, float a,
+                            int skyLight, int blockLight) {
+    queue(overlay, transform, r, g, b, a, skyLight, blockLight);
+}
+
+void ModelBatch::flush() {
+    draw(queued);
+}
+
+void ModelBatch::flushOverlay() {
+    draw(overlay);
+}
+
+void ModelBatch::queue(Queue& target, const glm::mat4& transform, float r, float g, float b, float a,
+                       int skyLight, int blockLight) {
+    auto channel = [](float c) {
+        return static_cast<uint32_t>(std::clamp(static_cast<int>(c * 255.0f), 0, 255));
+    };
+    uint32_t color = channel(r) | (channel(g) << 8) | (channel(b) << 16) | (channel(a) << 24);
+    uint8_t sky = static_cast<uint8_t>(std::clamp(skyLight, 0, 15));
+    uint8_t block = static_cast<uint8_t>(std::clamp(blockLight, 0, 15));
+
+    for (size_t p = 0; p < parts.size(); p++) {
+        const ModelPart* part = parts[p];
+        if (!part->visible || part->getQuadCount() == 0) continue;
+
+        Instance instance;
+        glm::mat4 partTransform = part->getTransform(transform, scale);
+        std::memcpy(instance.transform, glm::value_ptr(partTransform), sizeof(instance.transform));
+        instance.color = color;
+        instance.light[0] = sky;
+        instance.light[1] = block;
+        instance.light[2] = 0;
+        instance.light[3] = 0;
+
+        target.parts.push_back(static_cast<uint8_t>(p));
+        target.instances.push_back(instance);
+    }
+}
+
+void ModelBatch::compile() {
+    Tesselator t(true);
+    t.begin(DrawMode::Quads);
+    t.color(1.0f, 1.0f, 1.0f, 1.0f);
+
+    firstQuads.clear();
+    meshQuads = 0;
+    for (const ModelPart* part : parts) {
+        firstQuads.push_back(meshQuads);
+        part->compile(t, scale);
+        meshQuads += part->getQuadCount();
+    }
+
+    Tesselator::VertexData data = t.getVertexData();
+    mesh = RenderDevice::get().createVertexBuffer();
+    mesh->upload(data.vertices.data(), data.vertices.size() * sizeof(int), BufferUsage::Static);
+}
+
+void ModelBatch::draw(Queue& source) {
+    if (source.empty()) return;
+    if (!mesh) {
+        compile();
+    }
+
+    // Group the instances by part so each part's run is contiguous, then
+    // draw every part's quads over its run
+    static_assert(sizeof(Instance) == ModelVertexFormat::INSTANCE_STRIDE);
+    partOffsets.assign(parts.size(), 0);
+    for (uint8_t p : source.parts) {
+        partOffsets[p]++;
+    }
+
+    // Counts become offsets as the commands are laid out
+    commands.clear();
+    uint32_t offset = 0;
+    for (size_t p = 0; p < parts.size(); p++) {
+        uint32_t count = partOffsets[p];
+        partOffsets[p] = offset;
+        if (count == 0) continue;
+        uint32_t quads = static_cast<uint32_t>(parts[p]->getQuadCount());
+        commands.push_back({quads * 6, count, 0, firstQuads[p] * 4, offset});
+        offset += count;
+    }
+
+    sorted.resize(source.instances.size());
+    for (size_t i = 0; i < source.instances.size(); i++) {
+        sorted[partOffsets[source.parts[i]]++] = source.instances[i];
+    }
+    source.parts.clear();
+    source.instances.clear();
+
+    auto& device = RenderDevice::get();
+    IndexBuffer* quadIndices = device.getQuadIndexBuffer(meshQuads);
+    if (!instanceBuffer) {
+        instanceBuffer = device.createVertexBuffer();
+    }
+    instanceBuffer->upload(sorted.data(), sorted.size() * sizeof(Instance), BufferUsage::Stream);
+
+    mesh->bind();
+    device.setupModelVertexAttributes(instanceBuffer.get());
+    quadIndices->bind();
+    device.multiDrawIndexed(PrimitiveType::Triangles, commands.data(), commands.size());
+    mesh->unbind();
+}
+
+} // namespace mc
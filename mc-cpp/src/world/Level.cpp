@@ -31,6 +31,7 @@ Level::Level(int width, int height, int depth, long long seed)
     skyLight.resize(totalBlocks, 0);   // Initialize to 0, will be calculated properly
     blockLight.resize(totalBlocks, 0);
     heightMap.resize(static_cast<size_t>(width) * depth, 0);
+    sectionBlockCounts.resize(static_cast<size_t>(xChunks) * yChunks * zChunks, 0);
 
     // Initialize lighting engine
     lightingEngine = std::make_unique<LightingEngine>();
@@ -59,6 +60,46 @@ int Level::getTile(int x, int y, int z) const {
     return blocks[getIndex(x, y, z)];
 }
 
+static int getSectionIndex(const Level& level, int x, int y, int z) {
+    int sx = x / Level::CHUNK_SIZE;
+    int sy = y / Level::CHUNK_SIZE;
+    int sz = z / Level::CHUNK_SIZE;
+    if (sx >= level.xChunks || sy >= level.yChunks || sz >= level.zChunks) return -1;
+    return (sy * level.zChunks + sz) * level.xChunks + sx;
+}
+
+static void updateSectionCount(Level& level, int x, int y, int z, int oldTile, int newTile) {
+    if ((oldTile == 0) == (newTile == 0)) return;
+    int section = getSectionIndex(level, x, y, z);
+    if (section < 0) return;
+    if (newTile == 0) {
+        level.sectionBlockCounts[section]--;
+    } else {
+        level.sectionBlockCounts[section]++;
+    }
+}
+
+bool Level::isSectionEmpty(int x, int y, int z) const {
+    if (!isInBounds(x, y, z)) return true;
+    int section = getSectionIndex(*this, x, y, z);
+    return section >= 0 && sectionBlockCounts[section] == 0;
+}
+
+void Level::recountSections() {
+    std::fill(sectionBlockCounts.begin(), sectionBlockCounts.end(), 0);
+    for (int y = 0; y < height; y++) {
+        for (int z = 0; z < depth; z++) {
+            for (int x = 0; x < width; x++) {
+                if (blocks[getIndex(x, y, z)] == 0) continue;
+                int section = getSectionIndex(*this, x, y, z);
+                if (section >= 0) {
+                    sectionBlockCounts[section]++;
+                }
+            }
+        }
+    }
+}
+
 bool Level::setTile(int x, int y, int z, int tileId) {
     if (!isInBounds(x, y, z)) return false;
 
@@ -68,12 +109,14 @@ bool Level::setTile(int x, int y, int z, int tileId) {
     if (oldTile == tileId) return false;
 
     blocks[index] = static_cast<uint8_t>(tileId);
+    updateSectionCount(*this, x, y, z, oldTile, tileId);
 
     // Update height map first (needed for sky light calculations)
     updateHeightMap(x, z);
 
-    // Update lighting BEFORE notifying listeners
-    // This ensures chunks rebuild with correct light values, preventing flash-to-black
+    // Journal the light change BEFORE notifying listeners. It is applied at the end of
+    // the tick or before the next chunk rebuild, whichever comes first, so chunks
+    // never rebuild with stale light (no flash-to-black)
     updateLightAt(x, y, z);
 
     // Now notify listeners (chunk will rebuild with updated light)
@@ -89,6 +132,7 @@ bool Level::setTileWithData(int x, int y, int z, int tileId, int metadata) {
     if (!isInBounds(x, y, z)) return false;
 
     int index = getIndex(x, y, z);
+    updateSectionCount(*this, x, y, z, blocks[index], tileId);
     blocks[index] = static_cast<uint8_t>(tileId);
     data[index] = static_cast<uint8_t>(metadata);
 
@@ -363,15 +407,23 @@ float Level::getBrightnessForChunk(int x, int y, int z) const {
 }
 
 void Level::updateLightAt(int x, int y, int z) {
-    // Queue light update at this position for both sky and block light
+    // Journal the change; all edits made during a tick are relit together
+    // in flushLightUpdates instead of one remove/add BFS per setTile
+    if (lightingEngine) {
+        lightingEngine->journalUpdateAt(x, y, z);
+    }
+}
+
+void Level::flushLightUpdates() {
     if (lightingEngine) {
-        lightingEngine->queueUpdateAt(x, y, z);
+        lightingEngine->flushJournal();
     }
 }
 
 void Level::updateLights() {
-    // Process pending light updates
+    // Relight this tick's edits, then process pending region updates
     if (lightingEngine) {
+        lightingEngine->flushJournal();
         lightingEngine->processUpdates(500);  // Process up to 500 updates per tick
     }
 }
@@ -630,6 +682,8 @@ void Level::generateFlatWorld() {
         }
     }
 
+    recountSections();
+
     // Restore lighting engine and initialize lighting
     lightingEngine = std::move(tempEngine);
     if (lightingEngine) {
@@ -647,6 +701,8 @@ void Level::generateTerrain() {
 }
 
 void Level::initializeLight() {
+    recountSections();
+
     // Use lighting engine for proper initialization
     if (lightingEngine) {
         lightingEngine->initializeLighting();
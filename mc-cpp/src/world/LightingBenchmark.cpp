@@ -0,0 +1,402 @@
+#include "world/LightingBenchmark.hpp"
+#include "world/Level.hpp"
+#include "world/LightingEngine.hpp"
+#include "world/tile/Tile.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <thread>
+
+namespace mc {
+
+const char* LightingBenchmark::getModeName(Mode mode) {
+    switch (mode) {
+        case Mode::Immediate: return "immediate";
+        case Mode::Journaled: return "journaled";
+        case Mode::Queued:    return "queued";
+        case Mode::Parallel:  return "parallel";
+    }
+    return "unknown";
+}
+
+const char* LightingBenchmark::getPatternName(EditPattern pattern) {
+    switch (pattern) {
+        case EditPattern::Scattered: return "scattered";
+        case EditPattern::Clustered: return "clustered";
+    }
+    return "unknown";
+}
+
+bool LightingBenchmark::run(const Config& config) {
+    if (!Tile::tiles[Tile::STONE]) {
+        Tile::initTiles();
+    }
+
+    std::cout << "Lighting benchmark: " << config.width << "x" << config.height << "x" << config.depth
+              << ", " << config.edits << " edits, seed " << config.seed << std::endl;
+
+    bool passed = true;
+    for (EditPattern pattern : {EditPattern::Scattered, EditPattern::Clustered}) {
+        std::cout << " " << getPatternName(pattern) << " edits:" << std::endl;
+        std::vector<Edit> edits = generateEdits(config, pattern);
+
+        double immediate = 0.0, journaled = 0.0, ignored = 0.0;
+        passed &= runMode(config, Mode::Immediate, edits, immediate);
+        passed &= runMode(config, Mode::Journaled, edits, journaled);
+        passed &= runMode(config, Mode::Queued, edits, ignored);
+        passed &= runMode(config, Mode::Parallel, edits, ignored);
+
+        // Whether batching a tick's edits pays off over relighting each one
+        if (immediate > 0.0) {
+            std::cout << "  journaled / immediate: " << journaled / immediate << "x" << std::endl;
+        }
+    }
+
+    std::cout << "Lighting benchmark " << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed;
+}
+
+void LightingBenchmark::generateTerrain(Level& level, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    // Rolling hills around the middle of the level, with caves, pools and
+    // leaf canopies so every light blocking class shows up
+    int base = level.height / 2;
+    for (int x = 0; x < level.width; x++) {
+        for (int z = 0; z < level.depth; z++) {
+            int surface = base + static_cast<int>(std::sin(x * 0.2) * 4.0 + std::cos(z * 0.15) * 4.0);
+            surface = std::max(2, std::min(level.height - 8, surface));
+
+            level.blocks[level.getIndex(x, 0, z)] = Tile::BEDROCK;
+            for (int y = 1; y <= surface; y++) {
+                int tileId = Tile::STONE;
+                if (y == surface) tileId = Tile::GRASS;
+                else if (y > surface - 4) tileId = Tile::DIRT;
+                level.blocks[level.getIndex(x, y, z)] = static_cast<uint8_t>(tileId);
+            }
+
+            if (surface < base - 2) {
+                for (int y = surface + 1; y < base - 2; y++) {
+                    level.blocks[level.getIndex(x, y, z)] = Tile::STILL_WATER;
+                }
+            }
+        }
+    }
+
+    // Carve spherical caves below the surface
+    std::uniform_int_distribution<int> rx(0, level.width - 1);
+    std::uniform_int_distribution<int> ry(2, std::max(2, base - 6));
+    std::uniform_int_distribution<int> rz(0, level.depth - 1);
+    int caves = (level.width * level.depth) / 256;
+    for (int i = 0; i < caves; i++) {
+        int cx = rx(rng), cy = ry(rng), cz = rz(rng);
+        int r = 2 + percent(rng) % 4;
+        for (int x = cx - r; x <= cx + r; x++) {
+            for (int y = cy - r; y <= cy + r; y++) {
+                for (int z = cz - r; z <= cz + r; z++) {
+                    if (!level.isInBounds(x, y, z) || y < 1) continue;
+                    int dx = x - cx, dy = y - cy, dz = z - cz;
+                    if (dx * dx + dy * dy + dz * dz > r * r) continue;
+                    level.blocks[level.getIndex(x, y, z)] = Tile::AIR;
+                }
+            }
+        }
+        // Some caves get a light source
+        if (percent(rng) < 40 && level.isInBounds(cx, cy, cz)) {
+            level.blocks[level.getIndex(cx, cy, cz)] = Tile::GLOWSTONE;
+        }
+    }
+
+    // Leaf canopies floating above the hills
+    int canopies = (level.width * level.depth) / 512;
+    for (int i = 0; i < canopies; i++) {
+        int cx = rx(rng), cz = rz(rng);
+        int cy = std::min(level.height - 3, base + 8);
+        for (int x = cx - 2; x <= cx + 2; x++) {
+            for (int z = cz - 2; z <= cz + 2; z++) {
+                for (int y = cy; y < cy + 2; y++) {
+                    if (level.isInBounds(x, y, z)) {
+                        level.blocks[level.getIndex(x, y, z)] = Tile::LEAVES;
+                    }
+                }
+            }
+        }
+    }
+
+    for (int x = 0; x < level.width; x++) {
+        for (int z = 0; z < level.depth; z++) {
+            level.updateHeightMap(x, z);
+        }
+    }
+    level.recountSections();
+
+    level.lightingEngine->initializeLighting();
+}
+
+std::vector<LightingBenchmark::Edit> LightingBenchmark::generateEdits(const Config& config, EditPattern pattern) {
+    static const int palette[] = {
+        Tile::AIR, Tile::AIR, Tile::AIR, Tile::AIR, Tile::AIR, Tile::AIR, Tile::AIR, Tile::AIR,
+        Tile::STONE, Tile::STONE, Tile::STONE, Tile::STONE, Tile::DIRT,
+        Tile::GLASS, Tile::GLASS, Tile::LEAVES, Tile::STILL_WATER,
+        Tile::TORCH, Tile::TORCH, Tile::GLOWSTONE
+    };
+    static constexpr int paletteSize = sizeof(palette) / sizeof(palette[0]);
+
+    std::mt19937 rng(config.seed ^ 0x9E3779B9u);
+    std::uniform_int_distribution<int> rx(0, config.width - 1);
+    std::uniform_int_distribution<int> ry(config.height / 4, (config.height * 3) / 4);
+    std::uniform_int_distribution<int> rz(0, config.depth - 1);
+    std::uniform_int_distribution<int> rt(0, paletteSize - 1);
+
+    std::vector<Edit> edits;
+    edits.reserve(config.edits);
+    if (pattern == EditPattern::Scattered) {
+        for (int i = 0; i < config.edits; i++) {
+            edits.push_back({rx(rng), ry(rng), rz(rng), palette[rt(rng)]});
+        }
+        return edits;
+    }
+
+    // Each tick's edits share a spot, alternating between a 4x4x4 box
+    // aligned inside one chunk (digging out or building a room) and a
+    // column filled or dug out with one tile (a pillar or a shaft)
+    int perTick = std::max(1, config.editsPerTick);
+    std::uniform_int_distribution<int> offset(0, 3);
+    for (int burst = 0; static_cast<int>(edits.size()) < config.edits; burst++) {
+        int cx = rx(rng), cy = ry(rng), cz = rz(rng);
+        int count = std::min(perTick, config.edits - static_cast<int>(edits.size()));
+        if (burst % 2 == 0) {
+            int x0 = std::min((cx & ~15) + (cx & 12), config.width - 4);
+            int y0 = std::min((cy & ~15) + (cy & 12), config.height - 4);
+            int z0 = std::min((cz & ~15) + (cz & 12), config.depth - 4);
+            for (int i = 0; i < count; i++) {
+                edits.push_back({x0 + offset(rng), y0 + offset(rng), z0 + offset(rng), palette[rt(rng)]});
+            }
+        } else {
+            int tileId = palette[rt(rng)];
+            int y0 = std::max(0, std::min(cy, config.height - count));
+            for (int i = 0; i < count; i++) {
+                edits.push_back({cx, y0 + i, cz, tileId});
+            }
+        }
+    }
+    return edits;
+}
+
+void LightingBenchmark::applyEdit(Level& level, const Edit& edit, Mode mode) {
+    // Write the block directly instead of going through setTile so neighbor
+    // reactions (torches popping off, sand falling) can't make the modes diverge
+    int index = level.getIndex(edit.x, edit.y, edit.z);
+    if (level.blocks[index] == edit.tileId) return;
+
+    int oldHeight = level.getHeightAt(edit.x, edit.z);
+    level.blocks[index] = static_cast<uint8_t>(edit.tileId);
+    level.updateHeightMap(edit.x, edit.z);
+
+    LightingEngine& engine = *level.lightingEngine;
+    if (mode == Mode::Immediate) {
+        engine.queueUpdateAt(edit.x, edit.y, edit.z);
+        return;
+    }
+    if (mode == Mode::Journaled) {
+        engine.journalUpdateAt(edit.x, edit.y, edit.z);
+        return;
+    }
+
+    // Java-style: queue the column span whose sky exposure changed, plus the cell itself
+    int newHeight = level.getHeightAt(edit.x, edit.z);
+    int y0 = std::min({oldHeight, newHeight, edit.y});
+    int y1 = std::max({oldHeight, newHeight, edit.y});
+    engine.queueUpdate(LightLayer::SKY, edit.x, y0, edit.z, edit.x, y1, edit.z);
+    engine.queueUpdate(LightLayer::BLOCK, edit.x, edit.y, edit.z, edit.x, edit.y, edit.z);
+}
+
+bool LightingBenchmark::settle(Level& level, Mode mode) {
+    LightingEngine& engine = *level.lightingEngine;
+    if (mode == Mode::Journaled) {
+        engine.flushJournal();
+        return engine.getJournalSize() == 0;
+    }
+
+    if (engine.isMultithreaded()) {
+        auto start = std::chrono::steady_clock::now();
+        while (!engine.isIdle()) {
+            if (std::chrono::steady_clock::now() - start > std::chrono::seconds(30)) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    // Bound the work so a queue that never drains is reported instead of hanging
+    for (int i = 0; i < 10000; i++) {
+        if (engine.getPendingUpdateCount() == 0) return true;
+        engine.processUpdates(500);
+    }
+    return engine.getPendingUpdateCount() == 0;
+}
+
+bool LightingBenchmark::runMode(const Config& config, Mode mode, const std::vector<Edit>& edits,
+                                double& editsPerSec) {
+    Level level(config.width, config.height, config.depth, config.seed);
+    generateTerrain(level, config.seed);
+
+    LightingEngine& engine = *level.lightingEngine;
+    engine.setMultithreaded(mode == Mode::Parallel);
+
+    std::vector<uint8_t> refSky, refBlock;
+    computeReference(level, refSky, refBlock);
+    bool passed = compare(level, refSky, refBlock, 0);
+
+    engine.resetStats();
+    double seconds = 0.0;
+    bool settled = true;
+    int interval = std::max(1, config.checkInterval);
+    int perTick = std::max(1, config.editsPerTick);
+
+    for (size_t i = 0; i < edits.size(); i++) {
+        auto start = std::chrono::steady_clock::now();
+        applyEdit(level, edits[i], mode);
+
+        // Parallel mode keeps feeding the workers and only waits at checkpoints;
+        // journaled mode flushes once per simulated tick
+        bool checkpoint = (i + 1) % interval == 0 || i + 1 == edits.size();
+        bool tickEnd = (i + 1) % perTick == 0;
+        if (checkpoint || (mode == Mode::Journaled ? tickEnd : mode != Mode::Parallel)) {
+            settled &= settle(level, mode);
+        }
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (checkpoint) {
+            computeReference(level, refSky, refBlock);
+            passed &= compare(level, refSky, refBlock, static_cast<int>(i + 1));
+        }
+    }
+
+    engine.setMultithreaded(false);
+
+    uint64_t nodes = engine.getNodesVisited();
+    editsPerSec = seconds > 0.0 ? edits.size() / seconds : 0.0;
+    double nodesPerSec = seconds > 0.0 ? nodes / seconds : 0.0;
+
+    std::cout << "  " << getModeName(mode) << ": "
+              << edits.size() << " edits in " << seconds * 1000.0 << " ms ("
+              << static_cast<long long>(editsPerSec) << " edits/s), "
+              << nodes << " nodes (" << static_cast<long long>(nodesPerSec) << " nodes/s)"
+              << (settled ? "" : ", queue did not drain")
+              << (passed ? ", matches reference" : ", MISMATCH") << std::endl;
+
+    return passed && settled;
+}
+
+bool LightingBenchmark::compare(const Level& level, const std::vector<uint8_t>& skyLight,
+                                const std::vector<uint8_t>& blockLight, int editCount) {
+    int skyDiffs = 0, blockDiffs = 0, maxDiff = 0;
+    int firstX = -1, firstY = -1, firstZ = -1;
+
+    for (int y = 0; y < level.height; y++) {
+        for (int z = 0; z < level.depth; z++) {
+            for (int x = 0; x < level.width; x++) {
+                int index = level.getIndex(x, y, z);
+                int skyDiff = std::abs(level.skyLight[index] - skyLight[index]);
+                int blockDiff = std::abs(level.blockLight[index] - blockLight[index]);
+                if (skyDiff == 0 && blockDiff == 0) continue;
+
+                if (skyDiff) skyDiffs++;
+                if (blockDiff) blockDiffs++;
+                maxDiff = std::max(maxDiff, std::max(skyDiff, blockDiff));
+                if (firstX < 0) {
+                    firstX = x;
+                    firstY = y;
+                    firstZ = z;
+                }
+            }
+        }
+    }
+
+    if (skyDiffs == 0 && blockDiffs == 0) return true;
+
+    int index = level.getIndex(firstX, firstY, firstZ);
+    std::cout << "    after " << editCount << " edits: " << skyDiffs << " sky / "
+              << blockDiffs << " block cells differ (max diff " << maxDiff << "), first at ("
+              << firstX << ", " << firstY << ", " << firstZ << ") sky "
+              << static_cast<int>(level.skyLight[index]) << " expected " << static_cast<int>(skyLight[index])
+              << ", block " << static_cast<int>(level.blockLight[index])
+              << " expected " << static_cast<int>(blockLight[index]) << std::endl;
+    return false;
+}
+
+void LightingBenchmark::computeReference(const Level& level,
+                                         std::vector<uint8_t>& skyLight,
+                                         std::vector<uint8_t>& blockLight) {
+    int w = level.width, h = level.height, d = level.depth;
+    size_t total = static_cast<size_t>(w) * h * d;
+
+    // Heights recomputed from the blocks, using the same rule as Level::updateHeightMap
+    std::vector<int> heights(static_cast<size_t>(w) * d, 0);
+    for (int x = 0; x < w; x++) {
+        for (int z = 0; z < d; z++) {
+            for (int y = h - 1; y > 0; y--) {
+                if (Tile::lightBlock[level.getTile(x, y, z)] != 0) {
+                    heights[z * w + x] = y + 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Per-cell source and attenuation (minimum 1, matching calculateLightAt)
+    std::vector<uint8_t> skySource(total), blockSource(total), attenuation(total);
+    for (int y = 0; y < h; y++) {
+        for (int z = 0; z < d; z++) {
+            for (int x = 0; x < w; x++) {
+                int index = level.getIndex(x, y, z);
+                int tileId = level.blocks[index];
+                skySource[index] = y >= heights[z * w + x] ? 15 : 0;
+                blockSource[index] = Tile::lightEmission[tileId];
+                attenuation[index] = static_cast<uint8_t>(std::max<int>(1, Tile::lightBlock[tileId]));
+            }
+        }
+    }
+
+    // Relax from the sources up until a full sweep changes nothing (least fixed point).
+    // Out-of-bounds neighbors read as 15 for sky and 0 for block, like getBrightness.
+    auto relax = [&](std::vector<uint8_t>& light, const std::vector<uint8_t>& source, int outside) {
+        light = source;
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (int y = h - 1; y >= 0; y--) {
+                for (int z = 0; z < d; z++) {
+                    for (int x = 0; x < w; x++) {
+                        int index = level.getIndex(x, y, z);
+                        int att = attenuation[index];
+                        if (att >= 15 && source[index] == 0) continue;
+
+                        auto at = [&](int nx, int ny, int nz) -> int {
+                            if (!level.isInBounds(nx, ny, nz)) return outside;
+                            return light[level.getIndex(nx, ny, nz)];
+                        };
+                        int maxNeighbor = std::max({at(x - 1, y, z), at(x + 1, y, z),
+                                                    at(x, y - 1, z), at(x, y + 1, z),
+                                                    at(x, y, z - 1), at(x, y, z + 1)});
+                        int value = std::max<int>(source[index], maxNeighbor - att);
+                        if (value > light[index]) {
+                            light[index] = static_cast<uint8_t>(value);
+                            changed = true;
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    relax(skyLight, skySource, 15);
+    relax(blockLight, blockSource, 0);
+}
+
+} // namespace mc
@@ -2,7 +2,9 @@
 #include "world/Level.hpp"
 #include "world/tile/Tile.hpp"
 #include <algorithm>
+#include <bit>
 #include <cmath>
+#include <unordered_map>
 #include <unordered_set>
 #include <tuple>
 #include <utility>
@@ -57,6 +59,9 @@ LightingEngine::LightingEngine()
     : level(nullptr)
     , multithreaded(false)
     , running(false)
+    , activeWorkers(0)
+    , skyExposureSections(0)
+    , nodesVisited(0)
     , recurseCount(0)
 {
 }
@@ -102,12 +107,14 @@ void LightingEngine::workerFunction() {
             if (!updateQueue.empty()) {
                 update = updateQueue.front();
                 updateQueue.erase(updateQueue.begin());
+                activeWorkers++;
                 hasWork = true;
             }
         }
 
         if (hasWork) {
             processUpdate(update);
+            activeWorkers--;
         } else {
             std::unique_lock<std::mutex> lock(workMutex);
             workAvailable.wait_for(lock, std::chrono::milliseconds(10));
@@ -120,6 +127,11 @@ size_t LightingEngine::getPendingUpdateCount() const {
     return updateQueue.size();
 }
 
+bool LightingEngine::isIdle() const {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    return updateQueue.empty() && activeWorkers == 0;
+}
+
 void LightingEngine::queueUpdate(LightLayer layer, int x0, int y0, int z0, int x1, int y1, int z1) {
     if (!level) return;
 
@@ -182,30 +194,33 @@ void LightingEngine::queueUpdateAt(int x, int y, int z) {
     int tileId = level->getTile(x, y, z);
     int blockValue = (tileId > 0 && tileId < 256) ? Tile::lightBlock[tileId] : 0;
 
-    if (blockValue > 0) {
-        // Block was placed - remove sky light from column below using BFS darkness propagation
-        // This properly handles light "flowing out" of the now-dark room
+    // Sync the column's exposure bits with the (already updated) heightmap
+    std::vector<int> lostY, gainedY;
+    updateSkyExposure(x, z, lostY, gainedY);
 
-        // First handle the placed block position itself
+    if (blockValue > 0) {
+        // Block was placed - darken from the cells that stopped being directly
+        // sky-exposed (the bitset delta) and from the placed cell itself. The
+        // darkness BFS follows whatever they were feeding down the column, so a
+        // deep shaft no longer costs one BFS per cell
+        std::vector<std::tuple<int, int, int, int>> seeds;
         int currentLightAtPlaced = getBrightness(LightLayer::SKY, x, y, z);
         if (currentLightAtPlaced > 0 && !isSkyLit(x, y, z)) {
-            removeLightBFS(LightLayer::SKY, x, y, z, currentLightAtPlaced);
+            seeds.emplace_back(x, y, z, currentLightAtPlaced);
         }
-
-        // Then handle the column below the placed block
-        for (int cy = y - 1; cy >= 0; cy--) {
+        for (int cy : lostY) {
             int currentLight = getBrightness(LightLayer::SKY, x, cy, z);
-            if (currentLight > 0) {
-                // Check if this position is still sky-lit (might be if block placed below heightmap)
-                if (!isSkyLit(x, cy, z)) {
-                    // Remove light using BFS - this will propagate darkness and re-light from other sources
-                    removeLightBFS(LightLayer::SKY, x, cy, z, currentLight);
-                }
+            if (cy != y && currentLight > 0) {
+                seeds.emplace_back(x, cy, z, currentLight);
+            }
+        }
+
+        if (!seeds.empty()) {
+            std::vector<std::tuple<int, int, int>> readdQueue;
+            removeLightMultiBFS(LightLayer::SKY, seeds, readdQueue);
+            for (const auto& [rx, ry, rz] : readdQueue) {
+                propagateLightImmediateBFS(LightLayer::SKY, rx, ry, rz);
             }
-            // Stop if we hit a solid block (light below wouldn't have come from this column anyway)
-            int tile = level->getTile(x, cy, z);
-            int blockVal = (tile > 0 && tile < 256) ? Tile::lightBlock[tile] : 0;
-            if (blockVal >= 15) break;
         }
     } else {
         // Block was removed - sky light can now propagate down
@@ -213,12 +228,15 @@ void LightingEngine::queueUpdateAt(int x, int y, int z) {
         std::vector<std::pair<int, int>> litPositions;  // (y, lightLevel)
 
         int light = 15;
+        int columnHeight = level->getHeightAt(x, z);
         for (int cy = level->height - 1; cy >= 0; cy--) {
             int tile = level->getTile(x, cy, z);
             int blockVal = (tile > 0 && tile < 256) ? Tile::lightBlock[tile] : 0;
 
-            // Apply attenuation
-            light -= blockVal;
+            // Apply attenuation (at least 1 below the heightmap, like calculateLightAt)
+            if (cy < columnHeight) {
+                light -= std::max(1, blockVal);
+            }
             if (light < 0) light = 0;
 
             int currentLight = getBrightness(LightLayer::SKY, x, cy, z);
@@ -270,26 +288,229 @@ void LightingEngine::queueUpdateAt(int x, int y, int z) {
     }
 }
 
-void LightingEngine::removeLightBFS(LightLayer layer, int startX, int startY, int startZ, int oldLightValue) {
+void LightingEngine::journalUpdateAt(int x, int y, int z) {
     if (!level) return;
+    if (!level->isInBounds(x, y, z)) return;
+
+    int index = level->getIndex(x, y, z);
+    if (journalSet.insert(index).second) {
+        journal.push_back(index);
+    }
+}
+
+void LightingEngine::flushJournal() {
+    if (!level || journal.empty()) return;
 
     // Direction offsets for 6 neighbors
     static const int dx[] = {-1, 1, 0, 0, 0, 0};
     static const int dy[] = {0, 0, -1, 1, 0, 0};
     static const int dz[] = {0, 0, 0, 0, -1, 1};
 
-    // Queue for removing light: (x, y, z, lightValue)
-    std::vector<std::tuple<int, int, int, int>> removeQueue;
+    // Decode the journal back into positions. All edits are already in the level
+    // and the heightmap is final, so every decision below sees the end-of-tick state.
+    std::vector<std::tuple<int, int, int>> positions;
+    positions.reserve(journal.size());
+    for (int index : journal) {
+        int x = index % level->width;
+        int z = (index / level->width) % level->depth;
+        int y = index / (level->width * level->depth);
+        positions.emplace_back(x, y, z);
+    }
+    journal.clear();
+    journalSet.clear();
+
+    std::vector<std::tuple<int, int, int, int>> removeSeeds;
+    std::vector<std::tuple<int, int, int>> addSeeds;
+
+    // Every changed cell and its neighbors get re-evaluated in both layers
+    auto addChangedCells = [&]() {
+        for (const auto& [x, y, z] : positions) {
+            addSeeds.emplace_back(x, y, z);
+            for (int i = 0; i < 6; i++) {
+                addSeeds.emplace_back(x + dx[i], y + dy[i], z + dz[i]);
+            }
+        }
+    };
+
+    // Block light: darken from every cell that lost emission or now blocks more
+    // than before, then relight from the cells at the edge of the dark area
+    for (const auto& [x, y, z] : positions) {
+        int oldBlockLight = getBrightness(LightLayer::BLOCK, x, y, z);
+        int newBlockSource = getLightSource(LightLayer::BLOCK, x, y, z);
+        if (oldBlockLight > 0 && newBlockSource < oldBlockLight) {
+            removeSeeds.emplace_back(x, y, z, oldBlockLight);
+        }
+    }
+    if (!removeSeeds.empty()) {
+        removeLightMultiBFS(LightLayer::BLOCK, removeSeeds, addSeeds);
+    }
+    addChangedCells();
+    propagateLightFromSeeds(LightLayer::BLOCK, addSeeds);
+
+    // Sky light is handled per column: edits stacked in one column share a
+    // single darkening scan and a single top-down relight
+    removeSeeds.clear();
+    addSeeds.clear();
+
+    // Light-blocking edits below the heightmap darken from the edited cell itself
+    std::vector<std::pair<int, int>> columns;
+    std::unordered_set<int> columnsSeen;
+    for (const auto& [x, y, z] : positions) {
+        if (columnsSeen.insert(z * level->width + x).second) {
+            columns.emplace_back(x, z);
+        }
+        int tileId = level->getTile(x, y, z);
+        int blockValue = (tileId > 0 && tileId < 256) ? Tile::lightBlock[tileId] : 0;
+        int currentLight = getBrightness(LightLayer::SKY, x, y, z);
+        if (blockValue > 0 && currentLight > 0 && !isSkyLit(x, y, z)) {
+            removeSeeds.emplace_back(x, y, z, currentLight);
+        }
+    }
+
+    // Cells that stopped being directly sky-exposed since the last sync (the
+    // exposure bitset delta) seed the darkness pass; whatever they were feeding
+    // further down the column is reached by the BFS instead of a per-cell scan
+    std::vector<int> lostY, gainedY;
+    std::vector<std::pair<size_t, size_t>> gainedRanges;  // Per column, into gainedY
+    for (const auto& [x, z] : columns) {
+        lostY.clear();
+        size_t gainedStart = gainedY.size();
+        updateSkyExposure(x, z, lostY, gainedY);
+        gainedRanges.emplace_back(gainedStart, gainedY.size());
+        for (int cy : lostY) {
+            int currentLight = getBrightness(LightLayer::SKY, x, cy, z);
+            if (currentLight > 0) {
+                removeSeeds.emplace_back(x, cy, z, currentLight);
+            }
+        }
+    }
+    if (!removeSeeds.empty()) {
+        removeLightMultiBFS(LightLayer::SKY, removeSeeds, addSeeds);
+    }
+
+    // Relight each column: newly exposed cells become sources, then decay down
+    // from the heightmap (same attenuation as calculateLightAt), seeding
+    // horizontal spread from every cell that got brighter
+    auto raiseSkyLight = [&](int x, int y, int z, int light) {
+        if (light <= getBrightness(LightLayer::SKY, x, y, z)) return;
+        setBrightness(LightLayer::SKY, x, y, z, light);
+        if (light > 1) {
+            addSeeds.emplace_back(x - 1, y, z);
+            addSeeds.emplace_back(x + 1, y, z);
+            addSeeds.emplace_back(x, y, z - 1);
+            addSeeds.emplace_back(x, y, z + 1);
+        }
+    };
+    for (size_t c = 0; c < columns.size(); c++) {
+        auto [x, z] = columns[c];
+        for (size_t i = gainedRanges[c].first; i < gainedRanges[c].second; i++) {
+            raiseSkyLight(x, gainedY[i], z, 15);
+        }
+
+        int light = 15;
+        int columnHeight = std::min(level->getHeightAt(x, z), level->height);
+        for (int cy = columnHeight - 1; cy >= 0; cy--) {
+            int tile = level->getTile(x, cy, z);
+            int blockVal = (tile > 0 && tile < 256) ? Tile::lightBlock[tile] : 0;
+            light -= std::max(1, blockVal);
+            if (light <= 0) break;
+            raiseSkyLight(x, cy, z, light);
+        }
+    }
+    addChangedCells();
+    propagateLightFromSeeds(LightLayer::SKY, addSeeds);
+}
+
+uint16_t LightingEngine::skyExposureBits(int height, int section) {
+    // Bit i set when y = section * SECTION_HEIGHT + i is at or above the heightmap
+    int firstExposed = height - section * SECTION_HEIGHT;
+    if (firstExposed <= 0) return 0xFFFF;
+    if (firstExposed >= SECTION_HEIGHT) return 0;
+    return static_cast<uint16_t>(0xFFFF << firstExposed);
+}
+
+void LightingEngine::rebuildSkyExposure() {
+    if (!level) return;
+
+    skyExposureSections = (level->height + SECTION_HEIGHT - 1) / SECTION_HEIGHT;
+    skyExposure.assign(static_cast<size_t>(skyExposureSections) * level->width * level->depth, 0);
+    for (int z = 0; z < level->depth; z++) {
+        for (int x = 0; x < level->width; x++) {
+            int height = level->getHeightAt(x, z);
+            for (int section = 0; section < skyExposureSections; section++) {
+                skyExposure[(static_cast<size_t>(section) * level->depth + z) * level->width + x] =
+                    skyExposureBits(height, section);
+            }
+        }
+    }
+}
+
+void LightingEngine::updateSkyExposure(int x, int z, std::vector<int>& lostY, std::vector<int>& gainedY) {
+    if (!level) return;
+
+    size_t columnCount = static_cast<size_t>(level->width) * level->depth;
+    if (skyExposure.size() != columnCount * skyExposureSections || skyExposure.empty()) {
+        // Level was resized or never initialized; no old state to diff against
+        rebuildSkyExposure();
+        return;
+    }
+
+    int height = level->getHeightAt(x, z);
+    for (int section = 0; section < skyExposureSections; section++) {
+        uint16_t& bits = skyExposure[(static_cast<size_t>(section) * level->depth + z) * level->width + x];
+        uint16_t newBits = skyExposureBits(height, section);
+        uint16_t lost = bits & ~newBits;
+        uint16_t gained = newBits & ~bits;
+        bits = newBits;
+
+        int baseY = section * SECTION_HEIGHT;
+        while (lost) {
+            int y = baseY + std::countr_zero(lost);
+            if (y < level->height) lostY.push_back(y);
+            lost &= lost - 1;
+        }
+        while (gained) {
+            int y = baseY + std::countr_zero(gained);
+            if (y < level->height) gainedY.push_back(y);
+            gained &= gained - 1;
+        }
+    }
+}
+
+void LightingEngine::removeLightBFS(LightLayer layer, int startX, int startY, int startZ, int oldLightValue) {
+    if (!level) return;
+
+    std::vector<std::tuple<int, int, int, int>> seeds;
+    seeds.emplace_back(startX, startY, startZ, oldLightValue);
+
     // Queue for re-adding light from other sources
     std::vector<std::tuple<int, int, int>> readdQueue;
+    removeLightMultiBFS(layer, seeds, readdQueue);
 
-    // Start by setting the source position to 0
-    setBrightness(layer, startX, startY, startZ, 0);
-    removeQueue.emplace_back(startX, startY, startZ, oldLightValue);
+    // Re-propagate light from remaining sources
+    for (const auto& [rx, ry, rz] : readdQueue) {
+        propagateLightImmediateBFS(layer, rx, ry, rz);
+    }
+}
+
+void LightingEngine::removeLightMultiBFS(LightLayer layer, std::vector<std::tuple<int, int, int, int>>& seeds,
+                                         std::vector<std::tuple<int, int, int>>& readdSeeds) {
+    if (!level) return;
+
+    // Direction offsets for 6 neighbors
+    static const int dx[] = {-1, 1, 0, 0, 0, 0};
+    static const int dy[] = {0, 0, -1, 1, 0, 0};
+    static const int dz[] = {0, 0, 0, 0, -1, 1};
+
+    // Darken every seed up front so seeds never re-add each other's stale light.
+    // The seed vector doubles as the removal queue: (x, y, z, lightValue)
+    for (const auto& [sx, sy, sz, oldLight] : seeds) {
+        setBrightness(layer, sx, sy, sz, 0);
+    }
 
     size_t head = 0;
-    while (head < removeQueue.size()) {
-        auto [x, y, z, lightVal] = removeQueue[head++];
+    while (head < seeds.size()) {
+        auto [x, y, z, lightVal] = seeds[head++];
 
         // Check all 6 neighbors
         for (int i = 0; i < 6; i++) {
@@ -305,98 +526,80 @@ void LightingEngine::removeLightBFS(LightLayer layer, int startX, int startY, in
                 // This neighbor was receiving light from the removed source
                 // Remove its light and continue propagating darkness
                 setBrightness(layer, nx, ny, nz, 0);
-                removeQueue.emplace_back(nx, ny, nz, neighborLight);
+                seeds.emplace_back(nx, ny, nz, neighborLight);
             } else if (neighborLight > 0 && neighborLight >= lightVal) {
                 // This neighbor has light from another source
                 // Add it to re-propagation queue
-                readdQueue.emplace_back(nx, ny, nz);
+                readdSeeds.emplace_back(nx, ny, nz);
             }
         }
 
         // Safety limit
-        if (removeQueue.size() > 50000) break;
+        if (seeds.size() > 50000) break;
     }
 
-    // Re-propagate light from remaining sources
-    for (const auto& [rx, ry, rz] : readdQueue) {
-        propagateLightImmediateBFS(layer, rx, ry, rz);
-    }
+    nodesVisited.fetch_add(head, std::memory_order_relaxed);
 }
 
-void LightingEngine::propagateLightImmediateBFS(LightLayer layer, int startX, int startY, int startZ) {
+void LightingEngine::propagateLightFromSeeds(LightLayer layer, const std::vector<std::tuple<int, int, int>>& seeds) {
     if (!level) return;
 
-    // BFS queue: positions to check
-    std::vector<std::tuple<int, int, int>> queue;
-    queue.emplace_back(startX, startY, startZ);
-
-    // Track visited positions to avoid infinite loops
-    std::unordered_set<int64_t> visited;
-    auto posKey = [](int x, int y, int z) -> int64_t {
-        return (static_cast<int64_t>(x) & 0xFFFFF) |
-               ((static_cast<int64_t>(y) & 0xFF) << 20) |
-               ((static_cast<int64_t>(z) & 0xFFFFF) << 28);
-    };
-
     // Direction offsets for 6 neighbors
     static const int dx[] = {-1, 1, 0, 0, 0, 0};
     static const int dy[] = {0, 0, -1, 1, 0, 0};
     static const int dz[] = {0, 0, 0, 0, -1, 1};
 
+    // Worklist relaxation rather than a visited-set BFS: with many seeds, light
+    // from one seed can reach a cell after another seed's wave already passed it,
+    // so a cell is re-examined whenever one of its neighbors changes
+    std::vector<std::tuple<int, int, int>> queue(seeds.begin(), seeds.end());
+    size_t seedCount = queue.size();
+
     size_t head = 0;
     while (head < queue.size()) {
+        bool isSeed = head < seedCount;
         auto [x, y, z] = queue[head++];
 
-        int64_t key = posKey(x, y, z);
-        if (visited.count(key)) continue;
-        visited.insert(key);
-
         if (!level->isInBounds(x, y, z)) continue;
 
-        // Get current light value
         int currentLight = getBrightness(layer, x, y, z);
-
-        // Calculate what the light should be
         int newLight = calculateLightAt(layer, x, y, z);
 
-        // Update if changed
         bool lightChanged = (currentLight != newLight);
         if (lightChanged) {
             setBrightness(layer, x, y, z, newLight);
         }
 
-        // ALWAYS add neighbors if:
-        // 1. This is a light source (has light to spread), OR
-        // 2. Light changed at this position
-        // This ensures light "flows around" obstacles
-        bool isSource = (newLight > 0);
-        if (lightChanged || isSource) {
-            for (int i = 0; i < 6; i++) {
-                int nx = x + dx[i];
-                int ny = y + dy[i];
-                int nz = z + dz[i];
-
-                if (level->isInBounds(nx, ny, nz)) {
-                    int64_t nkey = posKey(nx, ny, nz);
-                    if (!visited.count(nkey)) {
-                        // Only add if neighbor might need updating
-                        int neighborLight = getBrightness(layer, nx, ny, nz);
-                        int expectedFromHere = newLight - 1;
-                        if (expectedFromHere < 0) expectedFromHere = 0;
-
-                        // Add if neighbor could receive more light from us,
-                        // or if neighbor has more light than expected (might need reduction)
-                        if (neighborLight < expectedFromHere || lightChanged) {
-                            queue.emplace_back(nx, ny, nz);
-                        }
-                    }
-                }
+        // Seeds spread their light even if unchanged (sources next to a carved gap);
+        // everything else only wakes its neighbors when it changed
+        if (!lightChanged && !(isSeed && newLight > 1)) continue;
+
+        for (int i = 0; i < 6; i++) {
+            int nx = x + dx[i];
+            int ny = y + dy[i];
+            int nz = z + dz[i];
+
+            if (!level->isInBounds(nx, ny, nz)) continue;
+
+            // Neighbors dimmer than we can feed may brighten; if we changed,
+            // neighbors that depended on our old value may need to dim
+            int neighborLight = getBrightness(layer, nx, ny, nz);
+            if (neighborLight < newLight - 1 || lightChanged) {
+                queue.emplace_back(nx, ny, nz);
             }
         }
 
-        // Safety limit to prevent infinite propagation
-        if (visited.size() > 50000) break;
+        // Safety limit to prevent runaway propagation
+        if (queue.size() > 500000) break;
     }
+
+    nodesVisited.fetch_add(head, std::memory_order_relaxed);
+}
+
+void LightingEngine::propagateLightImmediateBFS(LightLayer layer, int startX, int startY, int startZ) {
+    // A visited-once BFS leaves a cell at whatever value first reached it, so
+    // light arriving later by a brighter route was lost; relax instead
+    propagateLightFromSeeds(layer, {{startX, startY, startZ}});
 }
 
 void LightingEngine::processUpdates(int maxUpdates) {
@@ -442,6 +645,8 @@ void LightingEngine::propagateLightInRegion(LightLayer layer, int x0, int y0, in
         return;
     }
 
+    nodesVisited.fetch_add(static_cast<uint64_t>(volume), std::memory_order_relaxed);
+
     // Iterate in X, Z, Y order (matching Java)
     for (int x = x0; x <= x1; x++) {
         for (int z = z0; z <= z1; z++) {
@@ -614,9 +819,12 @@ void LightingEngine::updateLightIfOtherThan(LightLayer layer, int x, int y, int
         }
     }
 
-    // Only queue update if current value differs
+    // Queue if the value differs from what the neighbor implies, or from what
+    // the cell's own neighbors now give it. The first check alone assumes an
+    // attenuation of 1, so a stale cell behind water or leaves that happens to
+    // sit at the threshold would never be revisited
     int currentValue = getBrightness(layer, x, y, z);
-    if (currentValue != expectedValue) {
+    if (currentValue != expectedValue || currentValue != calculateLightAt(layer, x, y, z)) {
         queueUpdate(layer, x, y, z, x, y, z);
     }
 }
@@ -624,6 +832,8 @@ void LightingEngine::updateLightIfOtherThan(LightLayer layer, int x, int y, int
 void LightingEngine::initializeLighting() {
     if (!level) return;
 
+    rebuildSkyExposure();
+
     // Step 1: Calculate heightmap and initialize sky light columns (vertical propagation)
     for (int x = 0; x < level->width; x++) {
         for (int z = 0; z < level->depth; z++) {
@@ -631,9 +841,22 @@ void LightingEngine::initializeLighting() {
         }
     }
 
+    // Out-of-bounds reads as full sky light (getBrightness), so the world's
+    // side walls receive light from outside just like calculateLightAt sees it
+    for (int y = 0; y < level->height; y++) {
+        for (int x = 0; x < level->width; x++) {
+            propagateSkyLightTo(x, y, 0, 15);
+            propagateSkyLightTo(x, y, level->depth - 1, 15);
+        }
+        for (int z = 0; z < level->depth; z++) {
+            propagateSkyLightTo(0, y, z, 15);
+            propagateSkyLightTo(level->width - 1, y, z, 15);
+        }
+    }
+
     // Step 2: Propagate sky light horizontally (for overhangs, caves with openings, etc.)
     // Process in decreasing light levels for correct propagation
-    for (int lightLevel = 14; lightLevel >= 1; lightLevel--) {
+    for (int lightLevel = 15; lightLevel >= 1; lightLevel--) {
         for (int x = 0; x < level->width; x++) {
             for (int z = 0; z < level->depth; z++) {
                 for (int y = 0; y < level->height; y++) {
@@ -687,8 +910,10 @@ void LightingEngine::calculateSkyLightColumn(int x, int z) {
         int tileId = level->getTile(x, y, z);
         int blockValue = (tileId > 0 && tileId < 256) ? Tile::lightBlock[tileId] : 0;
 
-        // Apply attenuation
-        light -= blockValue;
+        // Apply attenuation (at least 1 below the heightmap, like calculateLightAt)
+        if (y < heightmapValue) {
+            light -= std::max(1, blockValue);
+        }
         if (light < 0) light = 0;
 
         // Set sky light
@@ -719,7 +944,7 @@ void LightingEngine::initializeBlockLight() {
 
     // Second pass: Propagate light from sources (matching Java lightLava pattern)
     // Process in decreasing light levels for correct propagation
-    for (int lightLevel = 14; lightLevel >= 1; lightLevel--) {
+    for (int lightLevel = 15; lightLevel >= 1; lightLevel--) {
         for (int x = 0; x < level->width; x++) {
             for (int z = 0; z < level->depth; z++) {
                 for (int y = 0; y < level->height; y++) {